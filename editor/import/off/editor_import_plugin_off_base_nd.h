@@ -2,12 +2,53 @@
 
 #include "../editor_import_plugin_base_nd.h"
 
+#include "../../../model/mesh/binary_mesh_nd.h"
+
+#if GDEXTENSION
+#include <godot_cpp/variant/utility_functions.hpp>
+#elif GODOT_MODULE
+#include "core/string/print_string.h"
+#endif
+
 class EditorImportPluginOFFBaseND : public EditorImportPluginBaseND {
 	GDCLASS(EditorImportPluginOFFBaseND, EditorImportPluginBaseND);
 
 protected:
 	static void _bind_methods() {}
 
+	// Shared by the mesh importers, which save to the binary mesh format with optional vertex quantization.
+#if GDEXTENSION
+	static Dictionary _make_vertex_compression_option() {
+		Dictionary option;
+		option["name"] = "vertex_compression";
+		option["type"] = Variant::INT;
+		option["default_value"] = (int)BinaryMeshND::ENCODING_FLOAT64;
+		option["property_hint"] = PROPERTY_HINT_ENUM;
+		option["hint_string"] = "Lossless,Float16,Float8";
+		return option;
+	}
+#elif GODOT_MODULE
+	static ImportOption _make_vertex_compression_option() {
+		return ImportOption(PropertyInfo(Variant::INT, "vertex_compression", PROPERTY_HINT_ENUM, "Lossless,Float16,Float8"), (int)BinaryMeshND::ENCODING_FLOAT64);
+	}
+#endif
+
+	static Error _save_binary_mesh(const Ref<MeshND> &p_mesh, const String &p_save_path, const int p_vertex_compression) {
+		ERR_FAIL_INDEX_V(p_vertex_compression, BinaryMeshND::ENCODING_FLOAT8 + 1, ERR_INVALID_PARAMETER);
+		const BinaryMeshND::Encoding encoding = (BinaryMeshND::Encoding)p_vertex_compression;
+		BinaryMeshND::QuantizationReport report;
+		const Error err = BinaryMeshND::save_to_file(p_mesh, p_save_path + String(".ndmesh"), encoding, &report);
+		if (err == OK && encoding != BinaryMeshND::ENCODING_FLOAT64) {
+			const String message = vformat("Quantized %s to %d bytes (%d lossless). Vertex error: max %f, RMS %f. Normal error: max %f, RMS %f.", p_mesh->get_name(), report.byte_count, report.unquantized_byte_count, report.max_vertex_error, report.rms_vertex_error, report.max_normal_error, report.rms_normal_error);
+#if GDEXTENSION
+			UtilityFunctions::print_verbose(message);
+#elif GODOT_MODULE
+			print_verbose(message);
+#endif
+		}
+		return err;
+	}
+
 public:
 	virtual int GDEXTMOD_GET_IMPORT_ORDER() const override { return 0; }
 #if GDEXTENSION
@@ -17,6 +17,7 @@ String EditorImportPluginOFFCellND::GDEXTMOD_GET_VISIBLE_NAME() const {
 #if GDEXTENSION
 TypedArray<Dictionary> EditorImportPluginOFFCellND::_get_import_options(const String &p_path, int32_t p_preset_index) const {
 	TypedArray<Dictionary> options;
+	options.append(_make_vertex_compression_option());
 	return options;
 }
 
@@ -26,11 +27,13 @@ Error EditorImportPluginOFFCellND::_import(const String &p_source_file, const St
 	Ref<ArrayCellMeshND> cell_mesh = off_doc->import_generate_array_cell_mesh_nd();
 	ERR_FAIL_COND_V(cell_mesh.is_null(), ERR_FILE_CORRUPT);
 	cell_mesh->set_name(p_source_file.get_file());
-	Error err = ResourceSaver::get_singleton()->save(cell_mesh, p_save_path + String(".res"));
+	Error err = _save_binary_mesh(cell_mesh, p_save_path, p_options[StringName("vertex_compression")]);
 	return err;
 }
 #elif GODOT_MODULE
-void EditorImportPluginOFFCellND::get_import_options(const String &p_path, List<ImportOption> *r_options, int p_preset) const {}
+void EditorImportPluginOFFCellND::get_import_options(const String &p_path, List<ImportOption> *r_options, int p_preset) const {
+	r_options->push_back(_make_vertex_compression_option());
+}
 
 #if VERSION_HEX < 0x040400
 Error EditorImportPluginOFFCellND::import(const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files, Variant *r_metadata)
@@ -43,7 +46,7 @@ Error EditorImportPluginOFFCellND::import(ResourceUID::ID p_source_id, const Str
 	Ref<ArrayCellMeshND> cell_mesh = off_doc->import_generate_array_cell_mesh_nd();
 	ERR_FAIL_COND_V(cell_mesh.is_null(), ERR_FILE_CORRUPT);
 	cell_mesh->set_name(p_source_file.get_file());
-	Error err = ResourceSaver::save(cell_mesh, p_save_path + String(".res"));
+	Error err = _save_binary_mesh(cell_mesh, p_save_path, p_options[StringName("vertex_compression")]);
 	return err;
 }
 #endif
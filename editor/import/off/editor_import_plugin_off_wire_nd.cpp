@@ -22,6 +22,7 @@ TypedArray<Dictionary> EditorImportPluginOFFWireND::_get_import_options(const St
 	deduplicate_edges["type"] = Variant::BOOL;
 	deduplicate_edges["default_value"] = true;
 	options.append(deduplicate_edges);
+	options.append(_make_vertex_compression_option());
 	return options;
 }
 
@@ -31,12 +32,13 @@ Error EditorImportPluginOFFWireND::_import(const String &p_source_file, const St
 	Ref<ArrayWireMeshND> wire_mesh = off_doc->import_generate_wire_mesh_nd(p_options[StringName("deduplicate_edges")]);
 	ERR_FAIL_COND_V(wire_mesh.is_null(), ERR_FILE_CORRUPT);
 	wire_mesh->set_name(p_source_file.get_file());
-	Error err = ResourceSaver::get_singleton()->save(wire_mesh, p_save_path + String(".res"));
+	Error err = _save_binary_mesh(wire_mesh, p_save_path, p_options[StringName("vertex_compression")]);
 	return err;
 }
 #elif GODOT_MODULE
 void EditorImportPluginOFFWireND::get_import_options(const String &p_path, List<ImportOption> *r_options, int p_preset) const {
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "deduplicate_edges"), true));
+	r_options->push_back(_make_vertex_compression_option());
 }
 
 #if VERSION_HEX < 0x040400
@@ -50,7 +52,7 @@ Error EditorImportPluginOFFWireND::import(ResourceUID::ID p_source_id, const Str
 	Ref<ArrayWireMeshND> wire_mesh = off_doc->import_generate_wire_mesh_nd(p_options[StringName("deduplicate_edges")]);
 	ERR_FAIL_COND_V(wire_mesh.is_null(), ERR_FILE_CORRUPT);
 	wire_mesh->set_name(p_source_file.get_file());
-	Error err = ResourceSaver::save(wire_mesh, p_save_path + String(".res"));
+	Error err = _save_binary_mesh(wire_mesh, p_save_path, p_options[StringName("vertex_compression")]);
 	return err;
 }
 #endif
@@ -12,6 +12,7 @@ public:
 	virtual String GDEXTMOD_GET_IMPORTER_NAME() const override;
 	virtual String GDEXTMOD_GET_RESOURCE_TYPE() const override;
 	virtual String GDEXTMOD_GET_VISIBLE_NAME() const override;
+	virtual String GDEXTMOD_GET_SAVE_EXTENSION() const override { return "ndmesh"; }
 	virtual float GDEXTMOD_GET_PRIORITY() const override { return 4.5f; }
 #if GDEXTENSION
 	virtual TypedArray<Dictionary> _get_import_options(const String &p_path, int32_t p_preset_index) const override;
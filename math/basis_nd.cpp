@@ -1,7 +1,60 @@
 #include "basis_nd.h"
 
+#include "fixed_matrix_nd.h"
+#include "inline_vector_nd.h"
 #include "vector_nd.h"
 
+// Fast paths for common dimensions, dispatched to with FIXED_MATRIX_ND_DISPATCH.
+// Each returns false if it can't handle the input, and the caller uses the general path.
+
+template <int N>
+static bool _compose_square_fixed(const Vector<VectorN> &p_parent_columns, const Vector<VectorN> &p_child_columns, Vector<VectorN> &r_composed) {
+	FixedMatrixND<N> parent;
+	FixedMatrixND<N> child;
+	FixedMatrixND<N> composed;
+	parent.load_square(p_parent_columns);
+	child.load_square(p_child_columns);
+	composed.compose(parent, child);
+	r_composed = composed.store_columns();
+	return true;
+}
+
+template <int N>
+static bool _determinant_fixed(const Vector<VectorN> &p_columns, double &r_determinant) {
+	if (!FixedMatrixND<N>::is_exactly_square(p_columns)) {
+		return false;
+	}
+	FixedMatrixND<N> matrix;
+	matrix.load_square(p_columns);
+	r_determinant = matrix.determinant();
+	return true;
+}
+
+template <int N>
+static bool _inverse_fixed(const Vector<VectorN> &p_columns, Vector<VectorN> &r_inverted) {
+	FixedMatrixND<N> matrix;
+	FixedMatrixND<N> inverted;
+	matrix.load_square(p_columns);
+	if (!matrix.invert(inverted)) {
+		return false;
+	}
+	r_inverted = inverted.store_columns();
+	return true;
+}
+
+template <int N>
+static bool _xform_fixed(const Vector<VectorN> &p_columns, const VectorN &p_vector, VectorN &r_result) {
+	if (p_vector.size() != N || !FixedMatrixND<N>::is_exactly_square(p_columns)) {
+		return false;
+	}
+	FixedMatrixND<N> matrix;
+	matrix.load_square(p_columns);
+	double result[N];
+	matrix.xform(p_vector.ptr(), result);
+	r_result = FixedMatrixND<N>::store_vector(result);
+	return true;
+}
+
 void BasisND::_make_basis_square_in_place(Vector<VectorN> &p_basis) {
 	const int64_t column_count = p_basis.size();
 	for (int64_t i = 0; i < column_count; i++) {
@@ -225,6 +278,12 @@ double BasisND::determinant() const {
 	if (column_count != row_count || column_count == 0) {
 		return 0.0;
 	}
+	double fixed_det = 0.0;
+	bool is_handled = false;
+	FIXED_MATRIX_ND_DISPATCH(column_count, is_handled, _determinant_fixed, _columns, fixed_det);
+	if (is_handled) {
+		return fixed_det;
+	}
 	// This algorithm needs to swap row items, so we need to copy the columns.
 	Vector<VectorN> local_columns = _columns;
 	double det = 1.0;
@@ -331,6 +390,13 @@ Ref<BasisND> BasisND::compose_square(const Ref<BasisND> &p_child_transform) cons
 	Ref<BasisND> ret;
 	ret.instantiate();
 	const int dimension = MAX(get_column_count(), p_child_transform->get_column_count());
+	Vector<VectorN> fixed_columns;
+	bool is_handled = false;
+	FIXED_MATRIX_ND_DISPATCH(dimension, is_handled, _compose_square_fixed, _columns, p_child_transform->_columns, fixed_columns);
+	if (is_handled) {
+		ret->set_all_columns(fixed_columns);
+		return ret;
+	}
 	const Ref<BasisND> parent = with_dimension(dimension);
 	const Ref<BasisND> child = p_child_transform->with_dimension(dimension);
 	const Vector<VectorN> &child_columns = child->get_all_columns();
@@ -383,19 +449,35 @@ Ref<BasisND> BasisND::transform_to(const Ref<BasisND> &p_to) const {
 }
 
 VectorN BasisND::xform(const VectorN &p_vector) const {
+	VectorN fixed_ret;
+	bool is_handled = false;
+	FIXED_MATRIX_ND_DISPATCH(p_vector.size(), is_handled, _xform_fixed, _columns, p_vector, fixed_ret);
+	if (is_handled) {
+		return fixed_ret;
+	}
+	InlineVectorN ret;
+	xform_into(p_vector, ret);
+	return ret.to_vector_n();
+}
+
+void BasisND::xform_into(const VectorN &p_vector, InlineVectorN &r_result) const {
 	const int dimension = MIN(p_vector.size(), _columns.size());
-	VectorN ret;
+	const double *vector_ptr = p_vector.ptr();
+	r_result.resize(0);
 	for (int i = 0; i < dimension; i++) {
-		VectorND::multiply_scalar_and_add_in_place(_columns[i], p_vector[i], ret);
+		r_result.multiply_scalar_and_add_in_place(_columns[i], vector_ptr[i]);
 	}
-	return ret;
 }
 
 Vector<VectorN> BasisND::xform_many(const Vector<VectorN> &p_vectors) const {
+	const int64_t vector_count = p_vectors.size();
 	Vector<VectorN> ret;
-	ret.resize(p_vectors.size());
-	for (int i = 0; i < p_vectors.size(); i++) {
-		ret.set(i, xform(p_vectors[i]));
+	ret.resize(vector_count);
+	VectorN *ret_ptrw = ret.ptrw();
+	InlineVectorN scratch;
+	for (int64_t i = 0; i < vector_count; i++) {
+		xform_into(p_vectors[i], scratch);
+		scratch.write_to_vector_n(ret_ptrw[i]);
 	}
 	return ret;
 }
@@ -403,9 +485,10 @@ Vector<VectorN> BasisND::xform_many(const Vector<VectorN> &p_vectors) const {
 VectorN BasisND::xform_axis(const VectorN &p_axis, const int p_axis_index) const {
 	const int column_count = _columns.size();
 	const int dimension = MIN(p_axis.size(), column_count);
-	VectorN ret;
+	const double *axis_ptr = p_axis.ptr();
+	InlineVectorN ret;
 	for (int i = 0; i < dimension; i++) {
-		VectorND::multiply_scalar_and_add_in_place(_columns[i], p_axis[i], ret);
+		ret.multiply_scalar_and_add_in_place(_columns[i], axis_ptr[i]);
 	}
 	// This is where the special case of this function comes in to handle axes.
 	// We want to treat the vector as if it had identity values in the missing dimensions.
@@ -413,9 +496,9 @@ VectorN BasisND::xform_axis(const VectorN &p_axis, const int p_axis_index) const
 	// the identity has 1.0 in the same index as the axis. So for example, if the Z
 	// axis only has 2 numbers, we assume the third is 1.0, so we add one of the third column.
 	if (p_axis_index < column_count && p_axis_index >= p_axis.size()) {
-		VectorND::add_in_place(_columns[p_axis_index], ret);
+		ret.add_in_place(_columns[p_axis_index]);
 	}
-	return ret;
+	return ret.to_vector_n();
 }
 
 VectorN BasisND::xform_transposed(const VectorN &p_vector) const {
@@ -510,6 +593,13 @@ Ref<BasisND> BasisND::inverse() const {
 	}
 	Ref<BasisND> inv;
 	inv.instantiate();
+	Vector<VectorN> fixed_inverted;
+	bool is_handled = false;
+	FIXED_MATRIX_ND_DISPATCH(dimension, is_handled, _inverse_fixed, _columns, fixed_inverted);
+	if (is_handled) {
+		inv->set_all_columns(fixed_inverted);
+		return inv;
+	}
 	// Operate on a square copy of the columns (Vector<> is copy-on-write).
 	Vector<VectorN> decomposed = _columns;
 	_make_basis_square_in_place(decomposed);
@@ -10,6 +10,8 @@
 #include "core/variant/typed_array.h"
 #endif
 
+class InlineVectorN;
+
 class BasisND : public RefCounted {
 	GDCLASS(BasisND, RefCounted);
 
@@ -65,6 +67,7 @@ public:
 	Ref<BasisND> transform_to(const Ref<BasisND> &p_to) const;
 
 	VectorN xform(const VectorN &p_vector) const;
+	void xform_into(const VectorN &p_vector, InlineVectorN &r_result) const;
 	Vector<VectorN> xform_many(const Vector<VectorN> &p_vectors) const;
 	VectorN xform_axis(const VectorN &p_axis, const int p_axis_index) const;
 	VectorN xform_transposed(const VectorN &p_vector) const;
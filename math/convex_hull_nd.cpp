@@ -0,0 +1,321 @@
+#include "convex_hull_nd.h"
+
+#include "index_tuple_set_nd.h"
+
+// Orthogonalizes the vector against the first p_basis_count vectors of _scratch_basis, and returns its length.
+double ConvexHullND::_orthogonalize(double *r_vector, const int64_t p_basis_count) const {
+	// Two passes keep the result orthogonal even when the vector is nearly in the span of the basis.
+	for (int pass = 0; pass < 2; pass++) {
+		for (int64_t b = 0; b < p_basis_count; b++) {
+			const double *basis_vector = _scratch_basis.ptr() + b * _dimension;
+			double dot = 0.0;
+			for (int64_t axis = 0; axis < _dimension; axis++) {
+				dot += r_vector[axis] * basis_vector[axis];
+			}
+			for (int64_t axis = 0; axis < _dimension; axis++) {
+				r_vector[axis] -= dot * basis_vector[axis];
+			}
+		}
+	}
+	double length_squared = 0.0;
+	for (int64_t axis = 0; axis < _dimension; axis++) {
+		length_squared += r_vector[axis] * r_vector[axis];
+	}
+	return Math::sqrt(length_squared);
+}
+
+bool ConvexHullND::_calculate_facet_plane(const int64_t p_facet) {
+	const int32_t *points = _facet_points.ptr() + p_facet * _dimension;
+	const double *origin = _get_point(points[0]);
+	_scratch_basis.resize((_dimension + 1) * _dimension);
+	for (int64_t i = 1; i < _dimension; i++) {
+		double *edge = _scratch_basis.ptr() + (i - 1) * _dimension;
+		const double *point = _get_point(points[i]);
+		for (int64_t axis = 0; axis < _dimension; axis++) {
+			edge[axis] = point[axis] - origin[axis];
+		}
+		const double length = _orthogonalize(edge, i - 1);
+		if (length <= CMP_EPSILON) {
+			return false;
+		}
+		for (int64_t axis = 0; axis < _dimension; axis++) {
+			edge[axis] /= length;
+		}
+	}
+	// The normal is the part of the axis least aligned with the facet which is orthogonal to it.
+	const int64_t edge_count = _dimension - 1;
+	int64_t best_axis = 0;
+	double best_alignment = Math_INF;
+	for (int64_t axis = 0; axis < _dimension; axis++) {
+		double alignment = 0.0;
+		for (int64_t b = 0; b < edge_count; b++) {
+			const double component = _scratch_basis[b * _dimension + axis];
+			alignment += component * component;
+		}
+		if (alignment < best_alignment) {
+			best_alignment = alignment;
+			best_axis = axis;
+		}
+	}
+	double *normal = _facet_normals.ptr() + p_facet * _dimension;
+	for (int64_t axis = 0; axis < _dimension; axis++) {
+		normal[axis] = axis == best_axis ? 1.0 : 0.0;
+	}
+	const double length = _orthogonalize(normal, edge_count);
+	double offset = 0.0;
+	double interior_distance = 0.0;
+	for (int64_t axis = 0; axis < _dimension; axis++) {
+		normal[axis] /= length;
+		offset += normal[axis] * origin[axis];
+		interior_distance += normal[axis] * _interior_point[axis];
+	}
+	interior_distance -= offset;
+	if (Math::abs(interior_distance) <= CMP_EPSILON) {
+		return false;
+	}
+	// Facet normals point out of the hull.
+	if (interior_distance > 0.0) {
+		for (int64_t axis = 0; axis < _dimension; axis++) {
+			normal[axis] = -normal[axis];
+		}
+		offset = -offset;
+	}
+	_facet_offsets[p_facet] = offset;
+	return true;
+}
+
+int64_t ConvexHullND::_add_facet() {
+	const int64_t facet = _facet_offsets.size();
+	_facet_points.resize((facet + 1) * _dimension);
+	_facet_neighbors.resize((facet + 1) * _dimension);
+	_facet_normals.resize((facet + 1) * _dimension);
+	_facet_offsets.push_back(0.0);
+	_facet_is_alive.push_back(1);
+	_facet_outside_points.push_back(LocalVector<int32_t>());
+	_facet_visit_stamps.push_back(0);
+	return facet;
+}
+
+// Adds the point to the outside set of the facet it is farthest above, if any.
+void ConvexHullND::_assign_outside_point(const int32_t p_point, const int64_t p_first_facet, const int64_t p_end_facet) {
+	int64_t best_facet = -1;
+	double best_distance = CMP_EPSILON;
+	for (int64_t facet = p_first_facet; facet < p_end_facet; facet++) {
+		if (!_facet_is_alive[facet]) {
+			continue;
+		}
+		const double distance = distance_to(facet, p_point);
+		if (distance > best_distance) {
+			best_distance = distance;
+			best_facet = facet;
+		}
+	}
+	if (best_facet >= 0) {
+		_facet_outside_points[best_facet].push_back(p_point);
+	}
+}
+
+bool ConvexHullND::_build_initial_simplex(LocalVector<int32_t> &r_simplex) {
+	// Greedily pick the point farthest from the span of the points picked so far, starting from an extreme point.
+	int32_t first = 0;
+	for (int64_t point = 1; point < _point_count; point++) {
+		if (_get_point(point)[0] < _get_point(first)[0]) {
+			first = point;
+		}
+	}
+	r_simplex.push_back(first);
+	_scratch_basis.resize((_dimension + 1) * _dimension);
+	LocalVector<double> offset_vector;
+	offset_vector.resize(_dimension);
+	for (int64_t basis_count = 0; basis_count < _dimension; basis_count++) {
+		int32_t best_point = -1;
+		double best_length = CMP_EPSILON;
+		for (int64_t point = 0; point < _point_count; point++) {
+			for (int64_t axis = 0; axis < _dimension; axis++) {
+				offset_vector[axis] = _get_point(point)[axis] - _get_point(first)[axis];
+			}
+			const double length = _orthogonalize(offset_vector.ptr(), basis_count);
+			if (length > best_length) {
+				best_length = length;
+				best_point = point;
+			}
+		}
+		if (best_point < 0) {
+			return false;
+		}
+		double *basis_vector = _scratch_basis.ptr() + basis_count * _dimension;
+		for (int64_t axis = 0; axis < _dimension; axis++) {
+			basis_vector[axis] = _get_point(best_point)[axis] - _get_point(first)[axis];
+		}
+		_orthogonalize(basis_vector, basis_count);
+		for (int64_t axis = 0; axis < _dimension; axis++) {
+			basis_vector[axis] /= best_length;
+		}
+		r_simplex.push_back(best_point);
+	}
+	return true;
+}
+
+bool ConvexHullND::_add_point_of_facet(const int64_t p_facet) {
+	// The farthest outside point is always a vertex of the final hull.
+	const LocalVector<int32_t> &outside_points = _facet_outside_points[p_facet];
+	int32_t apex = outside_points[0];
+	double apex_distance = distance_to(p_facet, apex);
+	for (const int32_t point : outside_points) {
+		const double distance = distance_to(p_facet, point);
+		if (distance > apex_distance) {
+			apex_distance = distance;
+			apex = point;
+		}
+	}
+	// Find all facets visible from the apex, which are connected. Facets visited but not visible are
+	// stamped with the negated stamp.
+	_visit_stamp++;
+	LocalVector<int32_t> visible_facets;
+	visible_facets.push_back(p_facet);
+	_facet_visit_stamps[p_facet] = _visit_stamp;
+	for (uint32_t i = 0; i < visible_facets.size(); i++) {
+		const int32_t *neighbors = _facet_neighbors.ptr() + visible_facets[i] * _dimension;
+		for (int64_t k = 0; k < _dimension; k++) {
+			const int32_t neighbor = neighbors[k];
+			if (_facet_visit_stamps[neighbor] == _visit_stamp || _facet_visit_stamps[neighbor] == -_visit_stamp) {
+				continue;
+			}
+			if (distance_to(neighbor, apex) > CMP_EPSILON) {
+				_facet_visit_stamps[neighbor] = _visit_stamp;
+				visible_facets.push_back(neighbor);
+			} else {
+				_facet_visit_stamps[neighbor] = -_visit_stamp;
+			}
+		}
+	}
+	// Connect each ridge on the horizon to the apex with a new facet, with the apex at the same position
+	// as the point opposite to the ridge, so the neighbor across the ridge stays at that position.
+	const int64_t first_new_facet = _facet_offsets.size();
+	IndexTupleSetND apex_ridges;
+	LocalVector<int64_t> apex_ridge_facet_positions;
+	LocalVector<int32_t> ridge;
+	ridge.resize(_dimension - 1);
+	for (const int32_t visible_facet : visible_facets) {
+		for (int64_t k = 0; k < _dimension; k++) {
+			const int32_t neighbor = _facet_neighbors[visible_facet * _dimension + k];
+			if (_facet_visit_stamps[neighbor] == _visit_stamp) {
+				continue;
+			}
+			const int64_t new_facet = _add_facet();
+			for (int64_t i = 0; i < _dimension; i++) {
+				_facet_points[new_facet * _dimension + i] = i == k ? apex : _facet_points[visible_facet * _dimension + i];
+				_facet_neighbors[new_facet * _dimension + i] = i == k ? neighbor : -1;
+			}
+			for (int64_t i = 0; i < _dimension; i++) {
+				if (_facet_neighbors[neighbor * _dimension + i] == visible_facet) {
+					_facet_neighbors[neighbor * _dimension + i] = new_facet;
+				}
+			}
+			if (!_calculate_facet_plane(new_facet)) {
+				return false;
+			}
+			// The other ridges of the new facet contain the apex, and are each shared with one other new facet.
+			for (int64_t skip = 0; skip < _dimension; skip++) {
+				if (skip == k) {
+					continue;
+				}
+				int64_t ridge_size = 0;
+				for (int64_t i = 0; i < _dimension; i++) {
+					if (i != skip) {
+						ridge[ridge_size++] = _facet_points[new_facet * _dimension + i];
+					}
+				}
+				ridge.sort();
+				bool inserted = false;
+				const int64_t ridge_index = apex_ridges.find_or_insert(ridge.ptr(), ridge_size, inserted);
+				if (inserted) {
+					apex_ridge_facet_positions.push_back(new_facet * _dimension + skip);
+				} else {
+					const int64_t other_position = apex_ridge_facet_positions[ridge_index];
+					_facet_neighbors[new_facet * _dimension + skip] = other_position / _dimension;
+					_facet_neighbors[other_position] = new_facet;
+				}
+			}
+		}
+	}
+	const int64_t end_new_facet = _facet_offsets.size();
+	for (int64_t i = first_new_facet * _dimension; i < end_new_facet * _dimension; i++) {
+		if (_facet_neighbors[i] < 0) {
+			return false;
+		}
+	}
+	for (const int32_t visible_facet : visible_facets) {
+		_facet_is_alive[visible_facet] = 0;
+		const LocalVector<int32_t> visible_outside_points = _facet_outside_points[visible_facet];
+		_facet_outside_points[visible_facet].clear();
+		for (const int32_t point : visible_outside_points) {
+			if (point != apex) {
+				_assign_outside_point(point, first_new_facet, end_new_facet);
+			}
+		}
+	}
+	return true;
+}
+
+double ConvexHullND::distance_to(const int64_t p_facet, const int64_t p_point) const {
+	const double *normal = _facet_normals.ptr() + p_facet * _dimension;
+	const double *point = _get_point(p_point);
+	double distance = -_facet_offsets[p_facet];
+	for (int64_t axis = 0; axis < _dimension; axis++) {
+		distance += normal[axis] * point[axis];
+	}
+	return distance;
+}
+
+// Returns false if the points are degenerate, in which case the caller should fall back to a slower method.
+bool ConvexHullND::build(const double *p_coordinates, const int64_t p_point_count, const int64_t p_dimension) {
+	_coordinates = p_coordinates;
+	_point_count = p_point_count;
+	_dimension = p_dimension;
+	if (_dimension < 1 || _point_count < _dimension + 1) {
+		return false;
+	}
+	LocalVector<int32_t> simplex;
+	if (!_build_initial_simplex(simplex)) {
+		return false;
+	}
+	_interior_point.resize(_dimension);
+	for (int64_t axis = 0; axis < _dimension; axis++) {
+		double sum = 0.0;
+		for (const int32_t point : simplex) {
+			sum += _get_point(point)[axis];
+		}
+		_interior_point[axis] = sum / simplex.size();
+	}
+	// Facet j of the initial simplex has every point except point j, and its neighbor
+	// across the ridge opposite to point i is facet i.
+	for (int64_t j = 0; j <= _dimension; j++) {
+		const int64_t facet = _add_facet();
+		int64_t k = 0;
+		for (int64_t i = 0; i <= _dimension; i++) {
+			if (i != j) {
+				_facet_points[facet * _dimension + k] = simplex[i];
+				_facet_neighbors[facet * _dimension + k] = i;
+				k++;
+			}
+		}
+		if (!_calculate_facet_plane(facet)) {
+			return false;
+		}
+	}
+	for (int64_t point = 0; point < _point_count; point++) {
+		if (!simplex.has(point)) {
+			_assign_outside_point(point, 0, _dimension + 1);
+		}
+	}
+	// New facets are appended, so one pass processes them all.
+	for (int64_t facet = 0; facet < get_facet_count(); facet++) {
+		if (_facet_is_alive[facet] && !_facet_outside_points[facet].is_empty()) {
+			if (!_add_point_of_facet(facet)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
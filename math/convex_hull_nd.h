@@ -0,0 +1,56 @@
+#pragma once
+
+#include "../godot_nd_defines.h"
+
+#if GDEXTENSION
+#include <godot_cpp/templates/local_vector.hpp>
+#elif GODOT_MODULE
+#include "core/templates/local_vector.h"
+#endif
+
+// Internal convex hull of a set of points that span all p_dimension dimensions, built with Quickhull
+// (beneath-beyond insertion of the farthest outside point of each facet). Points are read from a flat
+// array of doubles which must outlive the hull. Hull facets are simplexes, so a non-simplex face of a
+// polytope is made of several coplanar hull facets. Used by CellMeshND to find the faces of a cell.
+// Facet f has the points _facet_points[f * d + k], and _facet_neighbors[f * d + k] is the facet
+// on the other side of the ridge opposite to point k. Replaced facets stay in the arrays as dead facets.
+class ConvexHullND {
+	const double *_coordinates = nullptr;
+	int64_t _point_count = 0;
+	int64_t _dimension = 0;
+	LocalVector<int32_t> _facet_points;
+	LocalVector<int32_t> _facet_neighbors;
+	LocalVector<double> _facet_normals;
+	LocalVector<double> _facet_offsets;
+	LocalVector<uint8_t> _facet_is_alive;
+	LocalVector<LocalVector<int32_t>> _facet_outside_points;
+	LocalVector<int64_t> _facet_visit_stamps;
+	LocalVector<double> _interior_point;
+	LocalVector<double> _scratch_basis;
+	int64_t _visit_stamp = 0;
+
+	const double *_get_point(const int64_t p_point) const {
+		return _coordinates + p_point * _dimension;
+	}
+
+	double _orthogonalize(double *r_vector, const int64_t p_basis_count) const;
+
+	bool _calculate_facet_plane(const int64_t p_facet);
+
+	int64_t _add_facet();
+
+	void _assign_outside_point(const int32_t p_point, const int64_t p_first_facet, const int64_t p_end_facet);
+
+	bool _build_initial_simplex(LocalVector<int32_t> &r_simplex);
+
+	bool _add_point_of_facet(const int64_t p_facet);
+
+public:
+	int64_t get_facet_count() const { return _facet_offsets.size(); }
+	bool is_facet_alive(const int64_t p_facet) const { return _facet_is_alive[p_facet]; }
+	const double *get_facet_normal(const int64_t p_facet) const { return _facet_normals.ptr() + p_facet * _dimension; }
+
+	double distance_to(const int64_t p_facet, const int64_t p_point) const;
+
+	bool build(const double *p_coordinates, const int64_t p_point_count, const int64_t p_dimension);
+};
@@ -0,0 +1,328 @@
+#pragma once
+
+#include "../godot_nd_defines.h"
+
+// Fixed-size square matrices used as fast paths by BasisND and TransformND for the
+// dimensions most content uses. BasisND and TransformND store jagged, heap-allocated
+// columns and every operation works on them with dynamic loops; this instead keeps
+// N columns of N doubles on the stack, so the compiler can fully unroll the loops.
+// Determinants and inverses use closed forms for N <= 4 and an unrolled Gauss-Jordan
+// elimination above that. This is not exposed, callers dispatch on dimension at runtime.
+// Like BasisND, the storage is column-major: columns[c][r] is row r of column c.
+template <int N>
+struct FixedMatrixND {
+	static_assert(N >= 1, "FixedMatrixND: Dimension must be at least 1.");
+	double columns[N][N];
+
+	// Reads jagged columns as if made square, matching BasisND::_make_basis_square_in_place:
+	// missing columns and rows are filled with the identity, extra rows are discarded.
+	void load_square(const Vector<VectorN> &p_columns) {
+		const int64_t column_count = p_columns.size();
+		for (int c = 0; c < N; c++) {
+			if (c < column_count) {
+				const VectorN &column = p_columns[c];
+				const int64_t column_size = column.size();
+				const double *column_ptr = column.ptr();
+				for (int r = 0; r < N; r++) {
+					columns[c][r] = r < column_size ? column_ptr[r] : (r == c ? 1.0 : 0.0);
+				}
+			} else {
+				for (int r = 0; r < N; r++) {
+					columns[c][r] = r == c ? 1.0 : 0.0;
+				}
+			}
+		}
+	}
+
+	// True if there are exactly N columns with exactly N rows each, so no padding is needed.
+	static bool is_exactly_square(const Vector<VectorN> &p_columns) {
+		if (p_columns.size() != N) {
+			return false;
+		}
+		for (int c = 0; c < N; c++) {
+			if (p_columns[c].size() != N) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Reads a vector padded with zeros or truncated to N components.
+	static void load_vector(const VectorN &p_vector, double *r_out) {
+		const int64_t size = p_vector.size();
+		const double *vector_ptr = p_vector.ptr();
+		for (int i = 0; i < N; i++) {
+			r_out[i] = i < size ? vector_ptr[i] : 0.0;
+		}
+	}
+
+	static VectorN store_vector(const double *p_vector) {
+		VectorN ret;
+		ret.resize(N);
+		double *ret_ptrw = ret.ptrw();
+		for (int i = 0; i < N; i++) {
+			ret_ptrw[i] = p_vector[i];
+		}
+		return ret;
+	}
+
+	// Copies the columns into a dense column-major array of N * N doubles.
+	void store_dense(double *r_columns) const {
+		for (int c = 0; c < N; c++) {
+			for (int r = 0; r < N; r++) {
+				r_columns[c * N + r] = columns[c][r];
+			}
+		}
+	}
+
+	Vector<VectorN> store_columns() const {
+		Vector<VectorN> ret;
+		ret.resize(N);
+		VectorN *ret_ptrw = ret.ptrw();
+		for (int c = 0; c < N; c++) {
+			ret_ptrw[c].resize(N);
+			double *column_ptrw = ret_ptrw[c].ptrw();
+			for (int r = 0; r < N; r++) {
+				column_ptrw[r] = columns[c][r];
+			}
+		}
+		return ret;
+	}
+
+	// r_out = this * p_in, where p_in and r_out each hold N components.
+	_FORCE_INLINE_ void xform(const double *p_in, double *r_out) const {
+		for (int r = 0; r < N; r++) {
+			double sum = 0.0;
+			for (int c = 0; c < N; c++) {
+				sum += columns[c][r] * p_in[c];
+			}
+			r_out[r] = sum;
+		}
+	}
+
+	// this = p_parent * p_child. Must not alias either operand.
+	void compose(const FixedMatrixND &p_parent, const FixedMatrixND &p_child) {
+		for (int c = 0; c < N; c++) {
+			p_parent.xform(p_child.columns[c], columns[c]);
+		}
+	}
+
+	double determinant() const {
+		const double(&m)[N][N] = columns;
+		if constexpr (N == 1) {
+			return m[0][0];
+		} else if constexpr (N == 2) {
+			return m[0][0] * m[1][1] - m[1][0] * m[0][1];
+		} else if constexpr (N == 3) {
+			return m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2]) - m[1][0] * (m[0][1] * m[2][2] - m[2][1] * m[0][2]) + m[2][0] * (m[0][1] * m[1][2] - m[1][1] * m[0][2]);
+		} else if constexpr (N == 4) {
+			double s[6];
+			double t[6];
+			_compute_4x4_minors(s, t);
+			return s[0] * t[5] - s[1] * t[4] + s[2] * t[3] + s[3] * t[2] - s[4] * t[1] + s[5] * t[0];
+		} else {
+			// Gaussian elimination with partial pivoting, matching BasisND::determinant.
+			double a[N][N];
+			for (int c = 0; c < N; c++) {
+				for (int r = 0; r < N; r++) {
+					a[c][r] = m[c][r];
+				}
+			}
+			double det = 1.0;
+			for (int p = 0; p < N; p++) {
+				int pivot_row = p;
+				double abs_max_val = Math::abs(a[p][p]);
+				for (int r = p + 1; r < N; r++) {
+					const double abs_val = Math::abs(a[p][r]);
+					if (abs_val > abs_max_val) {
+						abs_max_val = abs_val;
+						pivot_row = r;
+					}
+				}
+				if (Math::is_zero_approx(abs_max_val)) {
+					return 0.0;
+				}
+				if (pivot_row != p) {
+					for (int c = 0; c < N; c++) {
+						SWAP(a[c][p], a[c][pivot_row]);
+					}
+					det = -det;
+				}
+				const double pivot_val = a[p][p];
+				for (int r = p + 1; r < N; r++) {
+					const double factor = a[p][r] / pivot_val;
+					for (int c = p; c < N; c++) {
+						a[c][r] -= factor * a[c][p];
+					}
+				}
+				det *= pivot_val;
+			}
+			return det;
+		}
+	}
+
+	// Writes the inverse into r_inverse and returns true, or returns false without a usable
+	// result if the matrix is singular or nearly singular, so the caller can fall back to
+	// the general path (which also reports the error).
+	bool invert(FixedMatrixND &r_inverse) const {
+		const double(&m)[N][N] = columns;
+		double(&inv)[N][N] = r_inverse.columns;
+		if constexpr (N == 1) {
+			if (Math::is_zero_approx(m[0][0])) {
+				return false;
+			}
+			inv[0][0] = 1.0 / m[0][0];
+			return true;
+		} else if constexpr (N == 2) {
+			const double det = determinant();
+			if (Math::is_zero_approx(det)) {
+				return false;
+			}
+			const double inv_det = 1.0 / det;
+			inv[0][0] = m[1][1] * inv_det;
+			inv[0][1] = -m[0][1] * inv_det;
+			inv[1][0] = -m[1][0] * inv_det;
+			inv[1][1] = m[0][0] * inv_det;
+			return true;
+		} else if constexpr (N == 3) {
+			// Adjugate divided by the determinant.
+			const double cof_00 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+			const double cof_01 = m[2][1] * m[0][2] - m[0][1] * m[2][2];
+			const double cof_02 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+			const double det = m[0][0] * cof_00 + m[1][0] * cof_01 + m[2][0] * cof_02;
+			if (Math::is_zero_approx(det)) {
+				return false;
+			}
+			const double inv_det = 1.0 / det;
+			inv[0][0] = cof_00 * inv_det;
+			inv[0][1] = cof_01 * inv_det;
+			inv[0][2] = cof_02 * inv_det;
+			inv[1][0] = (m[2][0] * m[1][2] - m[1][0] * m[2][2]) * inv_det;
+			inv[1][1] = (m[0][0] * m[2][2] - m[2][0] * m[0][2]) * inv_det;
+			inv[1][2] = (m[1][0] * m[0][2] - m[0][0] * m[1][2]) * inv_det;
+			inv[2][0] = (m[1][0] * m[2][1] - m[2][0] * m[1][1]) * inv_det;
+			inv[2][1] = (m[2][0] * m[0][1] - m[0][0] * m[2][1]) * inv_det;
+			inv[2][2] = (m[0][0] * m[1][1] - m[1][0] * m[0][1]) * inv_det;
+			return true;
+		} else if constexpr (N == 4) {
+			// Cofactor expansion using the 2x2 minors of the first two and last two columns.
+			// Written as if m were row-major: that computes the inverse of the transpose, which
+			// is the transpose of the inverse, so storing it the same way gives the inverse.
+			double s[6];
+			double t[6];
+			_compute_4x4_minors(s, t);
+			const double det = s[0] * t[5] - s[1] * t[4] + s[2] * t[3] + s[3] * t[2] - s[4] * t[1] + s[5] * t[0];
+			if (Math::is_zero_approx(det)) {
+				return false;
+			}
+			const double inv_det = 1.0 / det;
+			inv[0][0] = (m[1][1] * t[5] - m[1][2] * t[4] + m[1][3] * t[3]) * inv_det;
+			inv[0][1] = (-m[0][1] * t[5] + m[0][2] * t[4] - m[0][3] * t[3]) * inv_det;
+			inv[0][2] = (m[3][1] * s[5] - m[3][2] * s[4] + m[3][3] * s[3]) * inv_det;
+			inv[0][3] = (-m[2][1] * s[5] + m[2][2] * s[4] - m[2][3] * s[3]) * inv_det;
+			inv[1][0] = (-m[1][0] * t[5] + m[1][2] * t[2] - m[1][3] * t[1]) * inv_det;
+			inv[1][1] = (m[0][0] * t[5] - m[0][2] * t[2] + m[0][3] * t[1]) * inv_det;
+			inv[1][2] = (-m[3][0] * s[5] + m[3][2] * s[2] - m[3][3] * s[1]) * inv_det;
+			inv[1][3] = (m[2][0] * s[5] - m[2][2] * s[2] + m[2][3] * s[1]) * inv_det;
+			inv[2][0] = (m[1][0] * t[4] - m[1][1] * t[2] + m[1][3] * t[0]) * inv_det;
+			inv[2][1] = (-m[0][0] * t[4] + m[0][1] * t[2] - m[0][3] * t[0]) * inv_det;
+			inv[2][2] = (m[3][0] * s[4] - m[3][1] * s[2] + m[3][3] * s[0]) * inv_det;
+			inv[2][3] = (-m[2][0] * s[4] + m[2][1] * s[2] - m[2][3] * s[0]) * inv_det;
+			inv[3][0] = (-m[1][0] * t[3] + m[1][1] * t[1] - m[1][2] * t[0]) * inv_det;
+			inv[3][1] = (m[0][0] * t[3] - m[0][1] * t[1] + m[0][2] * t[0]) * inv_det;
+			inv[3][2] = (-m[3][0] * s[3] + m[3][1] * s[1] - m[3][2] * s[0]) * inv_det;
+			inv[3][3] = (m[2][0] * s[3] - m[2][1] * s[1] + m[2][2] * s[0]) * inv_det;
+			return true;
+		} else {
+			// Gauss-Jordan elimination with partial pivoting on [A | I].
+			double a[N][N];
+			for (int c = 0; c < N; c++) {
+				for (int r = 0; r < N; r++) {
+					a[c][r] = m[c][r];
+					inv[c][r] = r == c ? 1.0 : 0.0;
+				}
+			}
+			for (int p = 0; p < N; p++) {
+				int pivot_row = p;
+				double abs_max_val = Math::abs(a[p][p]);
+				for (int r = p + 1; r < N; r++) {
+					const double abs_val = Math::abs(a[p][r]);
+					if (abs_val > abs_max_val) {
+						abs_max_val = abs_val;
+						pivot_row = r;
+					}
+				}
+				if (Math::is_zero_approx(abs_max_val)) {
+					return false;
+				}
+				if (pivot_row != p) {
+					for (int c = 0; c < N; c++) {
+						SWAP(a[c][p], a[c][pivot_row]);
+						SWAP(inv[c][p], inv[c][pivot_row]);
+					}
+				}
+				const double inv_pivot = 1.0 / a[p][p];
+				for (int c = 0; c < N; c++) {
+					a[c][p] *= inv_pivot;
+					inv[c][p] *= inv_pivot;
+				}
+				for (int r = 0; r < N; r++) {
+					if (r == p) {
+						continue;
+					}
+					const double factor = a[p][r];
+					for (int c = 0; c < N; c++) {
+						a[c][r] -= factor * a[c][p];
+						inv[c][r] -= factor * inv[c][p];
+					}
+				}
+			}
+			return true;
+		}
+	}
+
+private:
+	// 2x2 minors of columns 0-1 (r_s) and columns 2-3 (r_t), over every pair of rows.
+	void _compute_4x4_minors(double *r_s, double *r_t) const {
+		const double(&m)[N][N] = columns;
+		r_s[0] = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+		r_s[1] = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+		r_s[2] = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+		r_s[3] = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+		r_s[4] = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+		r_s[5] = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+		r_t[0] = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+		r_t[1] = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+		r_t[2] = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+		r_t[3] = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+		r_t[4] = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+		r_t[5] = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+	}
+};
+
+// Largest dimension handled by FIXED_MATRIX_ND_DISPATCH, for sizing stack buffers.
+#define FIXED_MATRIX_ND_MAX_DIMENSION 6
+
+// Sets r_handled to the result of m_function<N>(...) if m_dimension has a FixedMatrixND
+// fast path, or to false otherwise, in which case the caller runs its general path.
+#define FIXED_MATRIX_ND_DISPATCH(m_dimension, r_handled, m_function, ...) \
+	switch (m_dimension) {                                                \
+		case 2:                                                           \
+			r_handled = m_function<2>(__VA_ARGS__);                       \
+			break;                                                        \
+		case 3:                                                           \
+			r_handled = m_function<3>(__VA_ARGS__);                       \
+			break;                                                        \
+		case 4:                                                           \
+			r_handled = m_function<4>(__VA_ARGS__);                       \
+			break;                                                        \
+		case 5:                                                           \
+			r_handled = m_function<5>(__VA_ARGS__);                       \
+			break;                                                        \
+		case 6:                                                           \
+			r_handled = m_function<6>(__VA_ARGS__);                       \
+			break;                                                        \
+		default:                                                          \
+			r_handled = false;                                            \
+			break;                                                        \
+	}
@@ -1,5 +1,6 @@
 #include "geometry_nd.h"
 
+#include "inline_vector_nd.h"
 #include "vector_nd.h"
 
 // Barycentric simplex calculations. Don't expose these, it just needs to be efficient
@@ -323,37 +324,49 @@ bool GeometryND::is_point_inside_simplex_barycentric(const Vector<VectorN> &p_ve
 }
 
 VectorN GeometryND::closest_point_on_line(const VectorN &p_line_position, const VectorN &p_line_direction, const VectorN &p_point) {
-	const VectorN vector_to_point = VectorND::subtract(p_point, p_line_position);
-	return VectorND::add(p_line_position, VectorND::project(vector_to_point, p_line_direction));
+	InlineVectorN vector_to_point;
+	InlineVectorN::subtract(p_point.ptr(), p_point.size(), p_line_position.ptr(), p_line_position.size(), vector_to_point);
+	const double projection_factor = vector_to_point.dot(p_line_direction) / VectorND::length_squared(p_line_direction);
+	InlineVectorN closest(p_line_position);
+	closest.multiply_scalar_and_add_in_place(p_line_direction, projection_factor);
+	return closest.to_vector_n();
 }
 
 VectorN GeometryND::closest_point_on_line_segment(const VectorN &p_line_a, const VectorN &p_line_b, const VectorN &p_point) {
-	const VectorN line_direction = VectorND::subtract(p_line_b, p_line_a);
-	const VectorN vector_to_point = VectorND::subtract(p_point, p_line_a);
-	const double projection_factor = VectorND::dot(vector_to_point, line_direction) / VectorND::length_squared(line_direction);
+	InlineVectorN line_direction;
+	InlineVectorN::subtract(p_line_b.ptr(), p_line_b.size(), p_line_a.ptr(), p_line_a.size(), line_direction);
+	InlineVectorN vector_to_point;
+	InlineVectorN::subtract(p_point.ptr(), p_point.size(), p_line_a.ptr(), p_line_a.size(), vector_to_point);
+	const double projection_factor = vector_to_point.dot(line_direction) / line_direction.length_squared();
 	if (projection_factor < 0.0) {
 		return p_line_a;
 	} else if (projection_factor > 1.0) {
 		return p_line_b;
 	}
-	return VectorND::add(p_line_a, VectorND::multiply_scalar(line_direction, projection_factor));
+	InlineVectorN closest(p_line_a);
+	closest.multiply_scalar_and_add_in_place(line_direction.ptr(), line_direction.size(), projection_factor);
+	return closest.to_vector_n();
 }
 
 VectorN GeometryND::closest_point_on_ray(const VectorN &p_ray_origin, const VectorN &p_ray_direction, const VectorN &p_point) {
-	const VectorN vector_to_point = VectorND::subtract(p_point, p_ray_origin);
-	const double projection_factor = VectorND::dot(vector_to_point, p_ray_direction) / VectorND::length_squared(p_ray_direction);
+	InlineVectorN vector_to_point;
+	InlineVectorN::subtract(p_point.ptr(), p_point.size(), p_ray_origin.ptr(), p_ray_origin.size(), vector_to_point);
+	const double projection_factor = vector_to_point.dot(p_ray_direction) / VectorND::length_squared(p_ray_direction);
 	if (projection_factor < 0.0) {
 		return p_ray_origin;
 	}
-	return VectorND::add(p_ray_origin, VectorND::multiply_scalar(p_ray_direction, projection_factor));
+	InlineVectorN closest(p_ray_origin);
+	closest.multiply_scalar_and_add_in_place(p_ray_direction, projection_factor);
+	return closest.to_vector_n();
 }
 
 VectorN GeometryND::closest_point_between_lines(const VectorN &p_line1_point, const VectorN &p_line1_dir, const VectorN &p_line2_point, const VectorN &p_line2_dir) {
-	const VectorN difference_between_points = VectorND::subtract(p_line1_point, p_line2_point);
+	InlineVectorN difference_between_points;
+	InlineVectorN::subtract(p_line1_point.ptr(), p_line1_point.size(), p_line2_point.ptr(), p_line2_point.size(), difference_between_points);
 	const double line1_len_sq = VectorND::length_squared(p_line1_dir);
 	const double line2_len_sq = VectorND::length_squared(p_line2_dir);
-	const double line1_projection = VectorND::dot(p_line1_dir, difference_between_points);
-	const double line2_projection = VectorND::dot(p_line2_dir, difference_between_points);
+	const double line1_projection = difference_between_points.dot(p_line1_dir);
+	const double line2_projection = difference_between_points.dot(p_line2_dir);
 	const double direction_dot = VectorND::dot(p_line1_dir, p_line2_dir);
 	const double denominator = line1_len_sq * line2_len_sq - direction_dot * direction_dot;
 	if (Math::is_zero_approx(denominator)) {
@@ -361,35 +374,41 @@ VectorN GeometryND::closest_point_between_lines(const VectorN &p_line1_point, co
 		return p_line1_point;
 	}
 	const double line1_factor = (direction_dot * line2_projection - line2_len_sq * line1_projection) / denominator;
-	const VectorN closest_point_on_line1 = VectorND::add(p_line1_point, VectorND::multiply_scalar(p_line1_dir, line1_factor));
-	return closest_point_on_line1;
+	InlineVectorN closest_point_on_line1(p_line1_point);
+	closest_point_on_line1.multiply_scalar_and_add_in_place(p_line1_dir, line1_factor);
+	return closest_point_on_line1.to_vector_n();
 }
 
 VectorN GeometryND::closest_point_between_line_segments(const VectorN &p_line1_a, const VectorN &p_line1_b, const VectorN &p_line2_a, const VectorN &p_line2_b) {
-	const VectorN difference_between_points = VectorND::subtract(p_line1_a, p_line2_a);
-	const VectorN line1_dir = VectorND::subtract(p_line1_b, p_line1_a);
-	const VectorN line2_dir = VectorND::subtract(p_line2_b, p_line2_a);
-	const double line1_len_sq = VectorND::length_squared(line1_dir);
-	const double line2_len_sq = VectorND::length_squared(line2_dir);
-	const double line1_projection = VectorND::dot(line1_dir, difference_between_points);
-	const double line2_projection = VectorND::dot(line2_dir, difference_between_points);
-	const double direction_dot = VectorND::dot(line1_dir, line2_dir);
+	InlineVectorN difference_between_points;
+	InlineVectorN::subtract(p_line1_a.ptr(), p_line1_a.size(), p_line2_a.ptr(), p_line2_a.size(), difference_between_points);
+	InlineVectorN line1_dir;
+	InlineVectorN::subtract(p_line1_b.ptr(), p_line1_b.size(), p_line1_a.ptr(), p_line1_a.size(), line1_dir);
+	InlineVectorN line2_dir;
+	InlineVectorN::subtract(p_line2_b.ptr(), p_line2_b.size(), p_line2_a.ptr(), p_line2_a.size(), line2_dir);
+	const double line1_len_sq = line1_dir.length_squared();
+	const double line2_len_sq = line2_dir.length_squared();
+	const double line1_projection = line1_dir.dot(difference_between_points);
+	const double line2_projection = line2_dir.dot(difference_between_points);
+	const double direction_dot = line1_dir.dot(line2_dir);
 	const double denominator = line1_len_sq * line2_len_sq - direction_dot * direction_dot;
 	if (Math::is_zero_approx(denominator)) {
 		// Lines are parallel, handling it as a special case.
 		return p_line1_a;
 	}
 	const double line1_factor = (direction_dot * line2_projection - line2_len_sq * line1_projection) / denominator;
-	const VectorN closest_point_on_line1 = VectorND::add(p_line1_a, VectorND::multiply_scalar(line1_dir, CLAMP(line1_factor, (double)0.0, (double)1.0)));
-	return closest_point_on_line1;
+	InlineVectorN closest_point_on_line1(p_line1_a);
+	closest_point_on_line1.multiply_scalar_and_add_in_place(line1_dir.ptr(), line1_dir.size(), CLAMP(line1_factor, (double)0.0, (double)1.0));
+	return closest_point_on_line1.to_vector_n();
 }
 
 Vector<VectorN> GeometryND::closest_points_between_lines(const VectorN &p_line1_point, const VectorN &p_line1_dir, const VectorN &p_line2_point, const VectorN &p_line2_dir) {
-	const VectorN difference_between_points = VectorND::subtract(p_line1_point, p_line2_point);
+	InlineVectorN difference_between_points;
+	InlineVectorN::subtract(p_line1_point.ptr(), p_line1_point.size(), p_line2_point.ptr(), p_line2_point.size(), difference_between_points);
 	const double line1_len_sq = VectorND::length_squared(p_line1_dir);
 	const double line2_len_sq = VectorND::length_squared(p_line2_dir);
-	const double line1_projection = VectorND::dot(p_line1_dir, difference_between_points);
-	const double line2_projection = VectorND::dot(p_line2_dir, difference_between_points);
+	const double line1_projection = difference_between_points.dot(p_line1_dir);
+	const double line2_projection = difference_between_points.dot(p_line2_dir);
 	const double direction_dot = VectorND::dot(p_line1_dir, p_line2_dir);
 	const double denominator = line1_len_sq * line2_len_sq - direction_dot * direction_dot;
 	if (Math::is_zero_approx(denominator)) {
@@ -398,20 +417,25 @@ Vector<VectorN> GeometryND::closest_points_between_lines(const VectorN &p_line1_
 	}
 	const double line1_factor = (direction_dot * line2_projection - line2_len_sq * line1_projection) / denominator;
 	const double line2_factor = (line1_len_sq * line2_projection - direction_dot * line1_projection) / denominator;
-	const VectorN closest_point_on_line1 = VectorND::add(p_line1_point, VectorND::multiply_scalar(p_line1_dir, line1_factor));
-	const VectorN closest_point_on_line2 = VectorND::add(p_line2_point, VectorND::multiply_scalar(p_line2_dir, line2_factor));
-	return Vector<VectorN>{ closest_point_on_line1, closest_point_on_line2 };
+	InlineVectorN closest_point_on_line1(p_line1_point);
+	closest_point_on_line1.multiply_scalar_and_add_in_place(p_line1_dir, line1_factor);
+	InlineVectorN closest_point_on_line2(p_line2_point);
+	closest_point_on_line2.multiply_scalar_and_add_in_place(p_line2_dir, line2_factor);
+	return Vector<VectorN>{ closest_point_on_line1.to_vector_n(), closest_point_on_line2.to_vector_n() };
 }
 
 Vector<VectorN> GeometryND::closest_points_between_line_segments(const VectorN &p_line1_a, const VectorN &p_line1_b, const VectorN &p_line2_a, const VectorN &p_line2_b) {
-	const VectorN difference_between_points = VectorND::subtract(p_line1_a, p_line2_a);
-	const VectorN line1_dir = VectorND::subtract(p_line1_b, p_line1_a);
-	const VectorN line2_dir = VectorND::subtract(p_line2_b, p_line2_a);
-	const double line1_len_sq = VectorND::length_squared(line1_dir);
-	const double line2_len_sq = VectorND::length_squared(line2_dir);
-	const double line1_projection = VectorND::dot(line1_dir, difference_between_points);
-	const double line2_projection = VectorND::dot(line2_dir, difference_between_points);
-	const double direction_dot = VectorND::dot(line1_dir, line2_dir);
+	InlineVectorN difference_between_points;
+	InlineVectorN::subtract(p_line1_a.ptr(), p_line1_a.size(), p_line2_a.ptr(), p_line2_a.size(), difference_between_points);
+	InlineVectorN line1_dir;
+	InlineVectorN::subtract(p_line1_b.ptr(), p_line1_b.size(), p_line1_a.ptr(), p_line1_a.size(), line1_dir);
+	InlineVectorN line2_dir;
+	InlineVectorN::subtract(p_line2_b.ptr(), p_line2_b.size(), p_line2_a.ptr(), p_line2_a.size(), line2_dir);
+	const double line1_len_sq = line1_dir.length_squared();
+	const double line2_len_sq = line2_dir.length_squared();
+	const double line1_projection = line1_dir.dot(difference_between_points);
+	const double line2_projection = line2_dir.dot(difference_between_points);
+	const double direction_dot = line1_dir.dot(line2_dir);
 	const double denominator = line1_len_sq * line2_len_sq - direction_dot * direction_dot;
 	if (Math::is_zero_approx(denominator)) {
 		// Lines are parallel, handling it as a special case.
@@ -419,28 +443,35 @@ Vector<VectorN> GeometryND::closest_points_between_line_segments(const VectorN &
 	}
 	const double line1_factor = (direction_dot * line2_projection - line2_len_sq * line1_projection) / denominator;
 	const double line2_factor = (line1_len_sq * line2_projection - direction_dot * line1_projection) / denominator;
-	const VectorN closest_point_on_line1 = VectorND::add(p_line1_a, VectorND::multiply_scalar(line1_dir, CLAMP(line1_factor, (double)0.0, (double)1.0)));
-	const VectorN closest_point_on_line2 = VectorND::add(p_line2_a, VectorND::multiply_scalar(line2_dir, CLAMP(line2_factor, (double)0.0, (double)1.0)));
-	return Vector<VectorN>{ closest_point_on_line1, closest_point_on_line2 };
+	InlineVectorN closest_point_on_line1(p_line1_a);
+	closest_point_on_line1.multiply_scalar_and_add_in_place(line1_dir.ptr(), line1_dir.size(), CLAMP(line1_factor, (double)0.0, (double)1.0));
+	InlineVectorN closest_point_on_line2(p_line2_a);
+	closest_point_on_line2.multiply_scalar_and_add_in_place(line2_dir.ptr(), line2_dir.size(), CLAMP(line2_factor, (double)0.0, (double)1.0));
+	return Vector<VectorN>{ closest_point_on_line1.to_vector_n(), closest_point_on_line2.to_vector_n() };
 }
 
 Vector<VectorN> GeometryND::closest_points_between_line_and_segment(const VectorN &p_line_point, const VectorN &p_line_direction, const VectorN &p_segment_a, const VectorN &p_segment_b) {
-	const VectorN difference_between_points = VectorND::subtract(p_line_point, p_segment_a);
-	const VectorN segment_dir = VectorND::subtract(p_segment_b, p_segment_a);
-	const double segment_len_sq = VectorND::length_squared(segment_dir);
-	const double line_projection = VectorND::dot(p_line_direction, difference_between_points);
-	const double segment_projection = VectorND::dot(segment_dir, difference_between_points);
-	const double direction_dot = VectorND::dot(p_line_direction, segment_dir);
-	const double denominator = VectorND::length_squared(p_line_direction) * segment_len_sq - direction_dot * direction_dot;
+	InlineVectorN difference_between_points;
+	InlineVectorN::subtract(p_line_point.ptr(), p_line_point.size(), p_segment_a.ptr(), p_segment_a.size(), difference_between_points);
+	InlineVectorN segment_dir;
+	InlineVectorN::subtract(p_segment_b.ptr(), p_segment_b.size(), p_segment_a.ptr(), p_segment_a.size(), segment_dir);
+	const double line_len_sq = VectorND::length_squared(p_line_direction);
+	const double segment_len_sq = segment_dir.length_squared();
+	const double line_projection = difference_between_points.dot(p_line_direction);
+	const double segment_projection = segment_dir.dot(difference_between_points);
+	const double direction_dot = segment_dir.dot(p_line_direction);
+	const double denominator = line_len_sq * segment_len_sq - direction_dot * direction_dot;
 	if (Math::is_zero_approx(denominator)) {
 		// Lines are parallel, handling it as a special case.
 		return Vector<VectorN>{ p_line_point, p_segment_a };
 	}
 	const double line_factor = (direction_dot * segment_projection - segment_len_sq * line_projection) / denominator;
-	const double segment_factor = (VectorND::length_squared(p_line_direction) * segment_projection - direction_dot * line_projection) / denominator;
-	const VectorN closest_point_on_line = VectorND::add(p_line_point, VectorND::multiply_scalar(p_line_direction, line_factor));
-	const VectorN closest_point_on_segment = VectorND::add(p_segment_a, VectorND::multiply_scalar(segment_dir, CLAMP(segment_factor, (double)0.0, (double)1.0)));
-	return Vector<VectorN>{ closest_point_on_line, closest_point_on_segment };
+	const double segment_factor = (line_len_sq * segment_projection - direction_dot * line_projection) / denominator;
+	InlineVectorN closest_point_on_line(p_line_point);
+	closest_point_on_line.multiply_scalar_and_add_in_place(p_line_direction, line_factor);
+	InlineVectorN closest_point_on_segment(p_segment_a);
+	closest_point_on_segment.multiply_scalar_and_add_in_place(segment_dir.ptr(), segment_dir.size(), CLAMP(segment_factor, (double)0.0, (double)1.0));
+	return Vector<VectorN>{ closest_point_on_line.to_vector_n(), closest_point_on_segment.to_vector_n() };
 }
 
 GeometryND *GeometryND::singleton = nullptr;
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../godot_nd_defines.h"
+
+#if GDEXTENSION
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#elif GODOT_MODULE
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#endif
+
+// Set of index tuples, each identified by the order in which it was first inserted.
+// Tuples must be sorted by the caller so that the same set of indices always matches.
+class IndexTupleSetND {
+	LocalVector<int32_t> _tuples;
+	LocalVector<int64_t> _tuple_offsets;
+	LocalVector<int32_t> _next_with_hash;
+	HashMap<uint32_t, int32_t> _first_with_hash;
+
+	static uint32_t _hash(const int32_t *p_tuple, const int64_t p_size) {
+		uint32_t hash = HASH_MURMUR3_SEED;
+		for (int64_t i = 0; i < p_size; i++) {
+			hash = hash_murmur3_one_32((uint32_t)p_tuple[i], hash);
+		}
+		return hash_fmix32(hash);
+	}
+
+public:
+	int64_t size() const { return _next_with_hash.size(); }
+	const int32_t *get_tuple(const int64_t p_index) const { return _tuples.ptr() + _tuple_offsets[p_index]; }
+	int64_t get_tuple_size(const int64_t p_index) const {
+		const int64_t end = p_index + 1 < size() ? _tuple_offsets[p_index + 1] : (int64_t)_tuples.size();
+		return end - _tuple_offsets[p_index];
+	}
+
+	int64_t find_or_insert(const int32_t *p_tuple, const int64_t p_size, bool &r_inserted) {
+		const uint32_t hash = _hash(p_tuple, p_size);
+		int32_t *first = _first_with_hash.getptr(hash);
+		if (first) {
+			for (int32_t i = *first; i >= 0; i = _next_with_hash[i]) {
+				if (get_tuple_size(i) == p_size && memcmp(get_tuple(i), p_tuple, sizeof(int32_t) * p_size) == 0) {
+					r_inserted = false;
+					return i;
+				}
+			}
+		}
+		const int32_t index = size();
+		_tuple_offsets.push_back(_tuples.size());
+		for (int64_t i = 0; i < p_size; i++) {
+			_tuples.push_back(p_tuple[i]);
+		}
+		if (first) {
+			_next_with_hash.push_back(*first);
+			*first = index;
+		} else {
+			_next_with_hash.push_back(-1);
+			_first_with_hash.insert(hash, index);
+		}
+		r_inserted = true;
+		return index;
+	}
+};
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "../godot_nd_defines.h"
+
+// Internal vector type for hot C++ math paths. Every VectorN (PackedFloat64Array) owns a
+// refcounted heap buffer, so building temporaries with VectorND::add, multiply_scalar, etc.
+// allocates on every call. InlineVectorN keeps up to INLINE_CAPACITY components on the stack
+// and only spills to the heap for higher dimensions, so callers never need a separate path.
+// This is not exposed to scripting: convert to VectorN with to_vector_n() at the boundary.
+class InlineVectorN {
+public:
+	static constexpr int64_t INLINE_CAPACITY = 16;
+
+private:
+	double _inline_data[INLINE_CAPACITY];
+	double *_heap_data = nullptr;
+	int64_t _size = 0;
+	int64_t _capacity = INLINE_CAPACITY;
+
+	_FORCE_INLINE_ double *_data() { return unlikely(_heap_data) ? _heap_data : _inline_data; }
+	_FORCE_INLINE_ const double *_data() const { return unlikely(_heap_data) ? _heap_data : _inline_data; }
+
+	void _reserve(const int64_t p_capacity) {
+		if (likely(p_capacity <= _capacity)) {
+			return;
+		}
+		double *new_data = (double *)memalloc(sizeof(double) * p_capacity);
+		const double *old_data = _data();
+		for (int64_t i = 0; i < _size; i++) {
+			new_data[i] = old_data[i];
+		}
+		if (_heap_data) {
+			memfree(_heap_data);
+		}
+		_heap_data = new_data;
+		_capacity = p_capacity;
+	}
+
+	void _copy_from(const double *p_data, const int64_t p_size) {
+		_reserve(p_size);
+		double *data = _data();
+		for (int64_t i = 0; i < p_size; i++) {
+			data[i] = p_data[i];
+		}
+		_size = p_size;
+	}
+
+public:
+	_FORCE_INLINE_ int64_t size() const { return _size; }
+	_FORCE_INLINE_ bool is_empty() const { return _size == 0; }
+	_FORCE_INLINE_ const double *ptr() const { return _data(); }
+	_FORCE_INLINE_ double *ptrw() { return _data(); }
+	_FORCE_INLINE_ double operator[](const int64_t p_index) const { return _data()[p_index]; }
+	_FORCE_INLINE_ double &operator[](const int64_t p_index) { return _data()[p_index]; }
+
+	// Resizes the vector, filling any new components with zero.
+	void resize(const int64_t p_size) {
+		_reserve(p_size);
+		double *data = _data();
+		for (int64_t i = _size; i < p_size; i++) {
+			data[i] = 0.0;
+		}
+		_size = p_size;
+	}
+
+	void fill(const double p_value) {
+		double *data = _data();
+		for (int64_t i = 0; i < _size; i++) {
+			data[i] = p_value;
+		}
+	}
+
+	// In-place operations. Like VectorND, missing components are treated as zero,
+	// and the vector grows when the other operand has more components.
+	void add_in_place(const double *p_other, const int64_t p_other_size) {
+		if (unlikely(_size < p_other_size)) {
+			resize(p_other_size);
+		}
+		double *data = _data();
+		for (int64_t i = 0; i < p_other_size; i++) {
+			data[i] += p_other[i];
+		}
+	}
+
+	void add_in_place(const VectorN &p_other) {
+		add_in_place(p_other.ptr(), p_other.size());
+	}
+
+	void subtract_in_place(const double *p_other, const int64_t p_other_size) {
+		if (unlikely(_size < p_other_size)) {
+			resize(p_other_size);
+		}
+		double *data = _data();
+		for (int64_t i = 0; i < p_other_size; i++) {
+			data[i] -= p_other[i];
+		}
+	}
+
+	void subtract_in_place(const VectorN &p_other) {
+		subtract_in_place(p_other.ptr(), p_other.size());
+	}
+
+	void multiply_scalar_in_place(const double p_scalar) {
+		double *data = _data();
+		for (int64_t i = 0; i < _size; i++) {
+			data[i] *= p_scalar;
+		}
+	}
+
+	void multiply_scalar_and_add_in_place(const double *p_other, const int64_t p_other_size, const double p_scalar) {
+		if (unlikely(_size < p_other_size)) {
+			resize(p_other_size);
+		}
+		double *data = _data();
+		for (int64_t i = 0; i < p_other_size; i++) {
+			data[i] += p_other[i] * p_scalar;
+		}
+	}
+
+	void multiply_scalar_and_add_in_place(const VectorN &p_other, const double p_scalar) {
+		multiply_scalar_and_add_in_place(p_other.ptr(), p_other.size(), p_scalar);
+	}
+
+	// Reductions.
+	double dot(const double *p_other, const int64_t p_other_size) const {
+		const double *data = _data();
+		const int64_t dimension = MIN(_size, p_other_size);
+		double sum = 0.0;
+		for (int64_t i = 0; i < dimension; i++) {
+			sum += data[i] * p_other[i];
+		}
+		return sum;
+	}
+
+	double dot(const VectorN &p_other) const { return dot(p_other.ptr(), p_other.size()); }
+	double dot(const InlineVectorN &p_other) const { return dot(p_other.ptr(), p_other.size()); }
+	double length_squared() const { return dot(_data(), _size); }
+	double length() const { return Math::sqrt(length_squared()); }
+
+	// Static helpers that write into an existing InlineVectorN instead of returning a new one.
+	static void lerp(const double *p_from, const int64_t p_from_size, const double *p_to, const int64_t p_to_size, const double p_weight, InlineVectorN &r_result) {
+		const int64_t dimension = MAX(p_from_size, p_to_size);
+		r_result._reserve(dimension);
+		r_result._size = dimension;
+		double *data = r_result._data();
+		for (int64_t i = 0; i < dimension; i++) {
+			const double a = likely(i < p_from_size) ? p_from[i] : 0.0;
+			const double b = likely(i < p_to_size) ? p_to[i] : 0.0;
+			data[i] = a + (b - a) * p_weight;
+		}
+	}
+
+	static void subtract(const double *p_a, const int64_t p_a_size, const double *p_b, const int64_t p_b_size, InlineVectorN &r_result) {
+		const int64_t dimension = MAX(p_a_size, p_b_size);
+		r_result._reserve(dimension);
+		r_result._size = dimension;
+		double *data = r_result._data();
+		for (int64_t i = 0; i < dimension; i++) {
+			const double a = likely(i < p_a_size) ? p_a[i] : 0.0;
+			const double b = likely(i < p_b_size) ? p_b[i] : 0.0;
+			data[i] = a - b;
+		}
+	}
+
+	// Conversion.
+	void set_from_vector_n(const VectorN &p_vector) { _copy_from(p_vector.ptr(), p_vector.size()); }
+	void set_from_ptr(const double *p_data, const int64_t p_size) { _copy_from(p_data, p_size); }
+
+	// Writes into an existing VectorN, which avoids an allocation if it is already
+	// the right size and not shared with any other PackedFloat64Array.
+	void write_to_vector_n(VectorN &r_vector) const {
+		if (r_vector.size() != _size) {
+			r_vector.resize(_size);
+		}
+		double *dest = r_vector.ptrw();
+		const double *data = _data();
+		for (int64_t i = 0; i < _size; i++) {
+			dest[i] = data[i];
+		}
+	}
+
+	VectorN to_vector_n() const {
+		VectorN ret;
+		write_to_vector_n(ret);
+		return ret;
+	}
+
+	InlineVectorN() {}
+	explicit InlineVectorN(const int64_t p_size) { resize(p_size); }
+	explicit InlineVectorN(const VectorN &p_vector) { set_from_vector_n(p_vector); }
+	InlineVectorN(const InlineVectorN &p_other) { _copy_from(p_other._data(), p_other._size); }
+	InlineVectorN &operator=(const InlineVectorN &p_other) {
+		if (this != &p_other) {
+			_copy_from(p_other._data(), p_other._size);
+		}
+		return *this;
+	}
+	~InlineVectorN() {
+		if (_heap_data) {
+			memfree(_heap_data);
+		}
+	}
+};
@@ -1,5 +1,9 @@
 #include "math_nd.h"
 
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
 // Math functions for the ND module that don't fit in any other file.
 // Prefer using GeometryND, VectorND, etc if those are appropriate.
 
@@ -262,6 +266,109 @@ uint16_t MathND::double_to_float16(const double p_double) {
 	return f16_sign | uint16_t(f16_exponent << 10) | uint16_t(f16_mantissa_bits);
 }
 
+void MathND::doubles_to_float8s(const double *p_doubles, uint8_t *r_float8s, const int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		r_float8s[i] = double_to_float8(p_doubles[i]);
+	}
+}
+
+void MathND::doubles_to_float16s(const double *p_doubles, uint16_t *r_float16s, const int64_t p_count) {
+	// Not vectorized with F16C, because it rounds ties to even while double_to_float16 rounds them away from zero.
+	for (int64_t i = 0; i < p_count; i++) {
+		r_float16s[i] = double_to_float16(p_doubles[i]);
+	}
+}
+
+void MathND::float8s_to_doubles(const uint8_t *p_float8s, double *r_doubles, const int64_t p_count) {
+	// With only 256 possible inputs, a lookup table is faster than decoding each value.
+	static const struct Float8Table {
+		double values[256];
+		Float8Table() {
+			for (int i = 0; i < 256; i++) {
+				values[i] = float8_to_double(uint8_t(i));
+			}
+		}
+	} table;
+	for (int64_t i = 0; i < p_count; i++) {
+		r_doubles[i] = table.values[p_float8s[i]];
+	}
+}
+
+void MathND::float16s_to_doubles(const uint16_t *p_float16s, double *r_doubles, const int64_t p_count) {
+	int64_t i = 0;
+#if defined(__F16C__)
+	// Half to single to double is exact, except that the hardware may quiet signaling NaNs,
+	// so groups containing any NaN use the scalar path to keep the payload bits identical.
+	for (; i + 4 <= p_count; i += 4) {
+		const uint16_t *group = p_float16s + i;
+		if ((group[0] & 0x7FFF) > 0x7C00 || (group[1] & 0x7FFF) > 0x7C00 || (group[2] & 0x7FFF) > 0x7C00 || (group[3] & 0x7FFF) > 0x7C00) {
+			for (int64_t j = 0; j < 4; j++) {
+				r_doubles[i + j] = float16_to_double(group[j]);
+			}
+			continue;
+		}
+		const __m128 singles = _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)group));
+		_mm256_storeu_pd(r_doubles + i, _mm256_cvtps_pd(singles));
+	}
+#endif
+	for (; i < p_count; i++) {
+		r_doubles[i] = float16_to_double(p_float16s[i]);
+	}
+}
+
+PackedByteArray MathND::double_array_to_float8_bytes(const PackedFloat64Array &p_doubles) {
+	PackedByteArray bytes;
+	bytes.resize(p_doubles.size());
+	if (!p_doubles.is_empty()) {
+		doubles_to_float8s(p_doubles.ptr(), bytes.ptrw(), p_doubles.size());
+	}
+	return bytes;
+}
+
+PackedByteArray MathND::double_array_to_float16_bytes(const PackedFloat64Array &p_doubles) {
+	PackedByteArray bytes;
+	bytes.resize(p_doubles.size() * 2);
+	if (!p_doubles.is_empty()) {
+		// Written byte by byte so the array is little-endian on every platform.
+		const double *doubles = p_doubles.ptr();
+		uint8_t *bytes_ptrw = bytes.ptrw();
+		for (int64_t i = 0; i < p_doubles.size(); i++) {
+			const uint16_t float16 = double_to_float16(doubles[i]);
+			bytes_ptrw[i * 2] = uint8_t(float16 & 0xFF);
+			bytes_ptrw[i * 2 + 1] = uint8_t(float16 >> 8);
+		}
+	}
+	return bytes;
+}
+
+PackedFloat64Array MathND::float8_bytes_to_double_array(const PackedByteArray &p_bytes) {
+	PackedFloat64Array doubles;
+	doubles.resize(p_bytes.size());
+	if (!p_bytes.is_empty()) {
+		float8s_to_doubles(p_bytes.ptr(), doubles.ptrw(), p_bytes.size());
+	}
+	return doubles;
+}
+
+PackedFloat64Array MathND::float16_bytes_to_double_array(const PackedByteArray &p_bytes) {
+	ERR_FAIL_COND_V_MSG(p_bytes.size() % 2 != 0, PackedFloat64Array(), "MathND: The float16 byte array must have an even size.");
+	const int64_t count = p_bytes.size() / 2;
+	PackedFloat64Array doubles;
+	doubles.resize(count);
+	if (count > 0) {
+		// Assembled from little-endian byte pairs, which also makes sure the uint16 values are aligned.
+		Vector<uint16_t> float16s;
+		float16s.resize(count);
+		const uint8_t *bytes = p_bytes.ptr();
+		uint16_t *float16s_ptrw = float16s.ptrw();
+		for (int64_t i = 0; i < count; i++) {
+			float16s_ptrw[i] = uint16_t(bytes[i * 2]) | uint16_t(bytes[i * 2 + 1] << 8);
+		}
+		float16s_to_doubles(float16s.ptr(), doubles.ptrw(), count);
+	}
+	return doubles;
+}
+
 #define QUANTIZE_TO_FLOAT_BITS(bits)                                                                                                                                                                              \
 	Variant MathND::quantize_to_float##bits(const Variant &p_variant) {                                                                                                                                           \
 		switch (p_variant.get_type()) {                                                                                                                                                                           \
@@ -472,6 +579,11 @@ void MathND::_bind_methods() {
 	ClassDB::bind_static_method("MathND", D_METHOD("double_to_float8", "double"), &MathND::double_to_float8);
 	ClassDB::bind_static_method("MathND", D_METHOD("double_to_float16", "double"), &MathND::double_to_float16);
 
+	ClassDB::bind_static_method("MathND", D_METHOD("double_array_to_float8_bytes", "doubles"), &MathND::double_array_to_float8_bytes);
+	ClassDB::bind_static_method("MathND", D_METHOD("double_array_to_float16_bytes", "doubles"), &MathND::double_array_to_float16_bytes);
+	ClassDB::bind_static_method("MathND", D_METHOD("float8_bytes_to_double_array", "bytes"), &MathND::float8_bytes_to_double_array);
+	ClassDB::bind_static_method("MathND", D_METHOD("float16_bytes_to_double_array", "bytes"), &MathND::float16_bytes_to_double_array);
+
 	ClassDB::bind_static_method("MathND", D_METHOD("quantize_to_float8", "value"), &MathND::quantize_to_float8);
 	ClassDB::bind_static_method("MathND", D_METHOD("quantize_to_float16", "value"), &MathND::quantize_to_float16);
 	ClassDB::bind_static_method("MathND", D_METHOD("has_common_int32", "a", "b"), &MathND::has_common_int32);
@@ -22,6 +22,16 @@ public:
 	static uint8_t double_to_float8(const double p_double);
 	static uint16_t double_to_float16(const double p_double);
 
+	// Batch conversions for C++ hot paths, giving the same results as the functions above for each value.
+	static void doubles_to_float8s(const double *p_doubles, uint8_t *r_float8s, const int64_t p_count);
+	static void doubles_to_float16s(const double *p_doubles, uint16_t *r_float16s, const int64_t p_count);
+	static void float8s_to_doubles(const uint8_t *p_float8s, double *r_doubles, const int64_t p_count);
+	static void float16s_to_doubles(const uint16_t *p_float16s, double *r_doubles, const int64_t p_count);
+	static PackedByteArray double_array_to_float8_bytes(const PackedFloat64Array &p_doubles);
+	static PackedByteArray double_array_to_float16_bytes(const PackedFloat64Array &p_doubles);
+	static PackedFloat64Array float8_bytes_to_double_array(const PackedByteArray &p_bytes);
+	static PackedFloat64Array float16_bytes_to_double_array(const PackedByteArray &p_bytes);
+
 	static Variant quantize_to_float8(const Variant &p_variant);
 	static Variant quantize_to_float16(const Variant &p_variant);
 
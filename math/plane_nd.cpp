@@ -125,9 +125,9 @@ Ref<PlaneND> PlaneND::from_normal_point(const VectorN &p_normal, const VectorN &
 	return plane;
 }
 
-Ref<PlaneND> PlaneND::from_points(const Vector<VectorN> &p_points) {
+// Slow path for points where the generalized cross product is not usable, such as nearly degenerate points.
+Ref<PlaneND> PlaneND::_from_points_orthonormalized(const Vector<VectorN> &p_points) {
 	Ref<PlaneND> plane;
-	ERR_FAIL_COND_V_MSG(p_points.is_empty(), Ref<PlaneND>(), "PlaneND.from_points: No points provided.");
 	const int point_count = p_points.size();
 	VectorN added = p_points[0];
 	for (int i = 1; i < point_count; i++) {
@@ -167,6 +167,49 @@ Ref<PlaneND> PlaneND::from_points(const Vector<VectorN> &p_points) {
 	return plane;
 }
 
+// The generalized cross product of the edges is the normal, with the same orientation as the orthonormalized
+// basis (a positive determinant with the normal last), and its length is the volume spanned by the edges.
+// Returns false if the edges are too close to degenerate to trust it.
+bool PlaneND::_calculate_normal_from_edges(const Vector<VectorN> &p_edges, VectorN &r_normal) {
+	double edge_volume = 1.0;
+	for (const VectorN &edge : p_edges) {
+		edge_volume *= VectorND::length(edge);
+	}
+	if (edge_volume == 0.0) {
+		return false;
+	}
+	const VectorN perpendicular = VectorND::perpendicular(p_edges);
+	const double length = VectorND::length(perpendicular);
+	if (length <= CMP_EPSILON * edge_volume) {
+		return false;
+	}
+	r_normal = VectorND::divide_scalar(perpendicular, length);
+	return true;
+}
+
+Ref<PlaneND> PlaneND::from_points(const Vector<VectorN> &p_points) {
+	ERR_FAIL_COND_V_MSG(p_points.is_empty(), Ref<PlaneND>(), "PlaneND.from_points: No points provided.");
+	const int point_count = p_points.size();
+	if (point_count < 2) {
+		return _from_points_orthonormalized(p_points);
+	}
+	for (const VectorN &point : p_points) {
+		if (point.size() != point_count) {
+			return _from_points_orthonormalized(p_points);
+		}
+	}
+	Vector<VectorN> edges;
+	edges.resize(point_count - 1);
+	for (int i = 1; i < point_count; i++) {
+		edges.set(i - 1, VectorND::subtract(p_points[i], p_points[0]));
+	}
+	VectorN normal;
+	if (!_calculate_normal_from_edges(edges, normal)) {
+		return _from_points_orthonormalized(p_points);
+	}
+	return from_normal_point(normal, p_points[0]);
+}
+
 void PlaneND::_bind_methods() {
 	// Trivial getters and setters.
 	ClassDB::bind_method(D_METHOD("get_dimension"), &PlaneND::get_dimension);
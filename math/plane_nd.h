@@ -14,8 +14,11 @@ class PlaneND : public RefCounted {
 	VectorN _normal;
 	double _distance = 0.0f;
 
+	static bool _calculate_normal_from_edges(const Vector<VectorN> &p_edges, VectorN &r_normal);
+
 protected:
 	static void _bind_methods();
+	static Ref<PlaneND> _from_points_orthonormalized(const Vector<VectorN> &p_points);
 
 public:
 	int64_t get_dimension() const { return _normal.size(); }
@@ -1,8 +1,182 @@
 #include "transform_nd.h"
 
+#include "fixed_matrix_nd.h"
+#include "inline_vector_nd.h"
 #include "rect_nd.h"
 #include "vector_nd.h"
 
+#include <atomic>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define TRANSFORM_ND_SIMD_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRANSFORM_ND_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define TRANSFORM_ND_SIMD_NEON
+#endif
+
+// Counts modifications of NodeND local transforms made while something else also references them. NodeND
+// pushes changes made through its own setters down to its descendants, but a transform modified through
+// another reference can't notify its node, so global transform caches fall back to comparing versions
+// whenever this count changes. Other transforms, like the renderer's scratch transforms, never affect it.
+static std::atomic<uint64_t> transform_nd_shared_change_count(0);
+
+void TransformND::_mark_changed() {
+	_version++;
+	if (_is_node_transform && get_reference_count() > 1) {
+		transform_nd_shared_change_count.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+uint64_t TransformND::get_shared_change_count() {
+	return transform_nd_shared_change_count.load(std::memory_order_relaxed);
+}
+
+// Batch kernel behind xform_many_flat: out = origin + matrix * in for every vertex.
+// The matrix is column-major, with p_out_stride rows per column, and both it and the origin
+// must be dense and zero-padded. Each output row is vectorized across SIMD lanes, with the
+// remainder handled by the scalar loop. Multiplies and adds are kept separate (no FMA), and
+// each lane accumulates in the same order as xform(), so every path gives identical results.
+static void _xform_flat_kernel(const double *p_matrix, const double *p_origin, const int p_column_count, const int p_out_stride, const double *p_in, const int p_in_stride, double *r_out, const int64_t p_vertex_count) {
+	for (int64_t vertex_index = 0; vertex_index < p_vertex_count; vertex_index++) {
+		const double *in_vertex = p_in + vertex_index * p_in_stride;
+		double *out_vertex = r_out + vertex_index * p_out_stride;
+		int row = 0;
+#if defined(TRANSFORM_ND_SIMD_AVX)
+		for (; row + 4 <= p_out_stride; row += 4) {
+			__m256d acc = _mm256_loadu_pd(p_origin + row);
+			for (int i = 0; i < p_column_count; i++) {
+				const __m256d column = _mm256_loadu_pd(p_matrix + i * p_out_stride + row);
+				acc = _mm256_add_pd(acc, _mm256_mul_pd(column, _mm256_set1_pd(in_vertex[i])));
+			}
+			_mm256_storeu_pd(out_vertex + row, acc);
+		}
+#endif
+#if defined(TRANSFORM_ND_SIMD_AVX) || defined(TRANSFORM_ND_SIMD_SSE2)
+		for (; row + 2 <= p_out_stride; row += 2) {
+			__m128d acc = _mm_loadu_pd(p_origin + row);
+			for (int i = 0; i < p_column_count; i++) {
+				const __m128d column = _mm_loadu_pd(p_matrix + i * p_out_stride + row);
+				acc = _mm_add_pd(acc, _mm_mul_pd(column, _mm_set1_pd(in_vertex[i])));
+			}
+			_mm_storeu_pd(out_vertex + row, acc);
+		}
+#elif defined(TRANSFORM_ND_SIMD_NEON)
+		for (; row + 2 <= p_out_stride; row += 2) {
+			float64x2_t acc = vld1q_f64(p_origin + row);
+			for (int i = 0; i < p_column_count; i++) {
+				const float64x2_t column = vld1q_f64(p_matrix + i * p_out_stride + row);
+				acc = vaddq_f64(acc, vmulq_f64(column, vdupq_n_f64(in_vertex[i])));
+			}
+			vst1q_f64(out_vertex + row, acc);
+		}
+#endif
+		for (; row < p_out_stride; row++) {
+			double acc = p_origin[row];
+			for (int i = 0; i < p_column_count; i++) {
+				acc += p_matrix[i * p_out_stride + row] * in_vertex[i];
+			}
+			out_vertex[row] = acc;
+		}
+	}
+}
+
+// Fast paths for common dimensions, dispatched to with FIXED_MATRIX_ND_DISPATCH.
+// Each returns false if it can't handle the input, and the caller uses the general path.
+
+template <int N>
+static bool _compose_square_fixed(const Vector<VectorN> &p_parent_columns, const VectorN &p_parent_origin, const Vector<VectorN> &p_child_columns, const VectorN &p_child_origin, double *r_columns, double *r_origin) {
+	FixedMatrixND<N> parent;
+	FixedMatrixND<N> child;
+	FixedMatrixND<N> composed;
+	parent.load_square(p_parent_columns);
+	child.load_square(p_child_columns);
+	composed.compose(parent, child);
+	composed.store_dense(r_columns);
+	double parent_origin[N];
+	double child_origin[N];
+	FixedMatrixND<N>::load_vector(p_parent_origin, parent_origin);
+	FixedMatrixND<N>::load_vector(p_child_origin, child_origin);
+	parent.xform(child_origin, r_origin);
+	for (int i = 0; i < N; i++) {
+		r_origin[i] += parent_origin[i];
+	}
+	return true;
+}
+
+template <int N>
+static bool _determinant_fixed(const Vector<VectorN> &p_columns, double &r_determinant) {
+	if (!FixedMatrixND<N>::is_exactly_square(p_columns)) {
+		return false;
+	}
+	FixedMatrixND<N> matrix;
+	matrix.load_square(p_columns);
+	r_determinant = matrix.determinant();
+	return true;
+}
+
+template <int N>
+static bool _inverse_basis_fixed(const Vector<VectorN> &p_columns, Vector<VectorN> &r_inverted) {
+	FixedMatrixND<N> matrix;
+	FixedMatrixND<N> inverted;
+	matrix.load_square(p_columns);
+	if (!matrix.invert(inverted)) {
+		return false;
+	}
+	r_inverted = inverted.store_columns();
+	return true;
+}
+
+template <int N>
+static bool _inverse_fixed(const Vector<VectorN> &p_columns, const VectorN &p_origin, double *r_columns, double *r_origin) {
+	FixedMatrixND<N> matrix;
+	FixedMatrixND<N> inverted;
+	matrix.load_square(p_columns);
+	if (!matrix.invert(inverted)) {
+		return false;
+	}
+	inverted.store_dense(r_columns);
+	double negated_origin[N];
+	FixedMatrixND<N>::load_vector(p_origin, negated_origin);
+	for (int i = 0; i < N; i++) {
+		negated_origin[i] = -negated_origin[i];
+	}
+	inverted.xform(negated_origin, r_origin);
+	return true;
+}
+
+// Loads columns as a dense column-major square matrix, filling missing values like _make_basis_square_in_place.
+static void _load_dense_square(const Vector<VectorN> &p_columns, const int p_dimension, double *r_matrix) {
+	const int column_count = p_columns.size();
+	for (int c = 0; c < p_dimension; c++) {
+		const int column_size = c < column_count ? p_columns[c].size() : 0;
+		const double *column_ptr = c < column_count ? p_columns[c].ptr() : nullptr;
+		for (int r = 0; r < p_dimension; r++) {
+			r_matrix[c * p_dimension + r] = r < column_size ? column_ptr[r] : (r == c ? 1.0 : 0.0);
+		}
+	}
+}
+
+template <int N>
+static bool _xform_fixed(const Vector<VectorN> &p_columns, const VectorN &p_origin, const VectorN &p_vector, VectorN &r_result) {
+	if (p_vector.size() != N || p_origin.size() != N || !FixedMatrixND<N>::is_exactly_square(p_columns)) {
+		return false;
+	}
+	FixedMatrixND<N> matrix;
+	matrix.load_square(p_columns);
+	double result[N];
+	matrix.xform(p_vector.ptr(), result);
+	const double *origin_ptr = p_origin.ptr();
+	for (int i = 0; i < N; i++) {
+		result[i] += origin_ptr[i];
+	}
+	r_result = FixedMatrixND<N>::store_vector(result);
+	return true;
+}
+
 void TransformND::_make_basis_square_in_place(Vector<VectorN> &p_basis) {
 	const int64_t column_count = p_basis.size();
 	for (int64_t i = 0; i < column_count; i++) {
@@ -32,6 +206,7 @@ Ref<BasisND> TransformND::get_basis() const {
 
 void TransformND::set_basis(const Ref<BasisND> &p_basis) {
 	ERR_FAIL_COND(p_basis.is_null());
+	_mark_changed();
 	_columns = p_basis->get_all_columns();
 }
 
@@ -40,6 +215,7 @@ Vector<VectorN> TransformND::get_all_basis_columns() const {
 }
 
 void TransformND::set_all_basis_columns(const Vector<VectorN> &p_columns) {
+	_mark_changed();
 	_columns = p_columns;
 }
 
@@ -53,6 +229,7 @@ TypedArray<VectorN> TransformND::get_all_basis_columns_bind() const {
 }
 
 void TransformND::set_all_basis_columns_bind(const TypedArray<VectorN> &p_columns) {
+	_mark_changed();
 	_columns.resize(p_columns.size());
 	for (int i = 0; i < p_columns.size(); i++) {
 		_columns.set(i, p_columns[i]);
@@ -77,6 +254,7 @@ void TransformND::set_basis_flat_array(const VectorN &p_array) {
 	const int column_count = _columns.size();
 	const int row_count = get_basis_row_count();
 	ERR_FAIL_COND_MSG(p_array.size() != column_count * row_count, "Input array size (" + itos(p_array.size()) + ") does not match the expected size (" + itos(column_count) + String(U" \u00D7 ") + itos(row_count) + " = " + itos(column_count * row_count) + ").");
+	_mark_changed();
 	for (int col_index = 0; col_index < column_count; col_index++) {
 		VectorN column;
 		column.resize(row_count);
@@ -109,6 +287,7 @@ VectorN TransformND::get_basis_column(const int p_index) const {
 }
 
 void TransformND::set_basis_column(const int p_index, const VectorN &p_column) {
+	_mark_changed();
 	if (p_index >= _columns.size()) {
 		_columns.resize(p_index + 1);
 	}
@@ -133,6 +312,7 @@ VectorN TransformND::get_basis_row(const int p_index) const {
 }
 
 void TransformND::set_basis_row(const int p_index, const VectorN &p_row) {
+	_mark_changed();
 	const int column_count = _columns.size();
 	for (int i = 0; i < column_count; i++) {
 		VectorN column = _columns[i];
@@ -158,6 +338,7 @@ double TransformND::get_basis_element(const int p_column, const int p_row) const
 }
 
 void TransformND::set_basis_element(const int p_column, const int p_row, const double p_value) {
+	_mark_changed();
 	if (p_column >= _columns.size()) {
 		_columns.resize(p_column + 1);
 	}
@@ -174,6 +355,7 @@ VectorN TransformND::get_origin() const {
 }
 
 void TransformND::set_origin(const VectorN &p_origin) {
+	_mark_changed();
 	_origin = p_origin;
 }
 
@@ -185,6 +367,7 @@ double TransformND::get_origin_element(const int p_index) const {
 }
 
 void TransformND::set_origin_element(const int p_index, const double p_value) {
+	_mark_changed();
 	if (p_index >= _origin.size()) {
 		_origin.resize(p_index + 1);
 	}
@@ -198,6 +381,7 @@ int TransformND::get_basis_column_count() const {
 }
 
 void TransformND::set_basis_column_count(const int p_column_count) {
+	_mark_changed();
 	_columns.resize(p_column_count);
 }
 
@@ -214,6 +398,7 @@ int TransformND::get_basis_dimension() const {
 }
 
 void TransformND::set_basis_dimension(const int p_basis_dimension) {
+	_mark_changed();
 	_columns.resize(p_basis_dimension);
 	_make_basis_square_in_place(_columns);
 }
@@ -231,6 +416,7 @@ int TransformND::get_basis_row_count() const {
 }
 
 void TransformND::set_basis_row_count(const int p_row_count) {
+	_mark_changed();
 	const int column_count = _columns.size();
 	for (int i = 0; i < column_count; i++) {
 		VectorN column = _columns[i];
@@ -249,6 +435,7 @@ int TransformND::get_dimension() const {
 }
 
 void TransformND::set_dimension(const int p_dimension) {
+	_mark_changed();
 	set_basis_dimension(p_dimension);
 	set_origin_dimension(p_dimension);
 }
@@ -258,6 +445,7 @@ int TransformND::get_origin_dimension() const {
 }
 
 void TransformND::set_origin_dimension(const int p_origin_dimension) {
+	_mark_changed();
 	const int current_size = _origin.size();
 	_origin.resize(p_origin_dimension);
 	for (int i = current_size; i < p_origin_dimension; i++) {
@@ -281,6 +469,12 @@ double TransformND::determinant() const {
 	if (column_count != row_count || column_count == 0) {
 		return 0.0;
 	}
+	double fixed_det = 0.0;
+	bool is_handled = false;
+	FIXED_MATRIX_ND_DISPATCH(column_count, is_handled, _determinant_fixed, _columns, fixed_det);
+	if (is_handled) {
+		return fixed_det;
+	}
 	// This algorithm needs to swap row items, so we need to copy the columns.
 	Vector<VectorN> local_columns = _columns;
 	double det = 1.0;
@@ -359,6 +553,67 @@ Ref<TransformND> TransformND::duplicate() const {
 	return ret;
 }
 
+void TransformND::copy_into(const Ref<TransformND> &r_result) const {
+	ERR_FAIL_COND(r_result.is_null());
+	if (r_result.ptr() == this) {
+		return;
+	}
+	// Copy element-wise into the existing arrays, so that when r_result already has the same
+	// shape and does not share its arrays, this does not allocate, and later writes to r_result
+	// do not have to copy-on-write arrays shared with this transform.
+	const int column_count = _columns.size();
+	if (r_result->_columns.size() != column_count) {
+		r_result->_columns.resize(column_count);
+	}
+	VectorN *result_columns_ptrw = r_result->_columns.ptrw();
+	for (int i = 0; i < column_count; i++) {
+		_copy_vector_in_place(_columns[i], result_columns_ptrw[i]);
+	}
+	_copy_vector_in_place(_origin, r_result->_origin);
+	r_result->_mark_changed();
+}
+
+void TransformND::_copy_vector_in_place(const VectorN &p_from, VectorN &r_to) {
+	const int64_t size = p_from.size();
+	if (r_to.size() != size) {
+		r_to.resize(size);
+	}
+	const double *from_ptr = p_from.ptr();
+	double *to_ptrw = r_to.ptrw();
+	for (int64_t i = 0; i < size; i++) {
+		to_ptrw[i] = from_ptr[i];
+	}
+}
+
+void TransformND::_set_dense_square(const double *p_columns, const double *p_origin, const int p_dimension) {
+	_mark_changed();
+	if (_columns.size() != p_dimension) {
+		_columns.resize(p_dimension);
+	}
+	VectorN *columns_ptrw = _columns.ptrw();
+	for (int c = 0; c < p_dimension; c++) {
+		VectorN &column = columns_ptrw[c];
+		if (column.size() != p_dimension) {
+			column.resize(p_dimension);
+		}
+		double *column_ptrw = column.ptrw();
+		for (int r = 0; r < p_dimension; r++) {
+			column_ptrw[r] = p_columns[c * p_dimension + r];
+		}
+	}
+	if (p_origin == nullptr) {
+		_origin.resize(0);
+		return;
+	}
+	if (_origin.size() != p_dimension) {
+		_origin.resize(p_dimension);
+	}
+	double *origin_ptrw = _origin.ptrw();
+	for (int i = 0; i < p_dimension; i++) {
+		origin_ptrw[i] = p_origin[i];
+	}
+}
+
 bool TransformND::is_equal_approx(const Ref<TransformND> &p_other) const {
 	const int basis_dimension = MAX(get_basis_dimension(), p_other->get_basis_dimension());
 	for (int i = 0; i < basis_dimension; i++) {
@@ -388,20 +643,49 @@ Ref<TransformND> TransformND::lerp(const Ref<TransformND> &p_to, const double p_
 Ref<TransformND> TransformND::compose_square(const Ref<TransformND> &p_child_transform) const {
 	Ref<TransformND> ret;
 	ret.instantiate();
-	const int dimension = MAX(MAX(get_basis_column_count(), get_origin_dimension()), MAX(p_child_transform->get_basis_column_count(), p_child_transform->get_origin_dimension()));
-	const Ref<TransformND> parent = with_dimension(dimension);
-	const Ref<TransformND> child = p_child_transform->with_dimension(dimension);
-	const Vector<VectorN> &child_columns = child->get_all_basis_columns();
-	Vector<VectorN> ret_columns;
-	ret_columns.resize(child_columns.size());
-	for (int i = 0; i < child_columns.size(); i++) {
-		ret_columns.set(i, parent->xform_basis_axis(child_columns[i], i));
-	}
-	ret->set_all_basis_columns(ret_columns);
-	ret->set_origin(parent->xform(p_child_transform->get_origin()));
+	compose_square_into(p_child_transform, ret);
 	return ret;
 }
 
+void TransformND::compose_square_into(const Ref<TransformND> &p_child_transform, const Ref<TransformND> &r_result) const {
+	ERR_FAIL_COND(p_child_transform.is_null() || r_result.is_null());
+	const TransformND *child = p_child_transform.ptr();
+	// Both transforms are treated as if padded with the identity to a square matrix of this dimension,
+	// like with_dimension() would. The result is fully computed before writing, so r_result may alias either input.
+	const int dimension = MAX(MAX(_columns.size(), _origin.size()), MAX(child->_columns.size(), child->_origin.size()));
+	bool is_handled = false;
+	double fixed_columns[FIXED_MATRIX_ND_MAX_DIMENSION * FIXED_MATRIX_ND_MAX_DIMENSION];
+	double fixed_origin[FIXED_MATRIX_ND_MAX_DIMENSION];
+	FIXED_MATRIX_ND_DISPATCH(dimension, is_handled, _compose_square_fixed, _columns, _origin, child->_columns, child->_origin, fixed_columns, fixed_origin);
+	if (is_handled) {
+		r_result->_set_dense_square(fixed_columns, fixed_origin, dimension);
+		return;
+	}
+	InlineVectorN parent_matrix(dimension * dimension);
+	InlineVectorN child_matrix(dimension * dimension);
+	InlineVectorN composed_matrix(dimension * dimension);
+	InlineVectorN composed_origin(_origin);
+	composed_origin.resize(dimension);
+	_load_dense_square(_columns, dimension, parent_matrix.ptrw());
+	_load_dense_square(child->_columns, dimension, child_matrix.ptrw());
+	const double *parent_ptr = parent_matrix.ptr();
+	const double *child_ptr = child_matrix.ptr();
+	double *composed_ptr = composed_matrix.ptrw();
+	for (int c = 0; c < dimension; c++) {
+		for (int k = 0; k < dimension; k++) {
+			const double child_value = child_ptr[c * dimension + k];
+			for (int r = 0; r < dimension; r++) {
+				composed_ptr[c * dimension + r] += parent_ptr[k * dimension + r] * child_value;
+			}
+		}
+	}
+	const int child_origin_size = child->_origin.size();
+	for (int k = 0; k < child_origin_size; k++) {
+		composed_origin.multiply_scalar_and_add_in_place(parent_ptr + k * dimension, dimension, child->_origin[k]);
+	}
+	r_result->_set_dense_square(composed_ptr, composed_origin.ptr(), dimension);
+}
+
 Ref<TransformND> TransformND::compose_expand(const Ref<TransformND> &p_child_transform) const {
 	Ref<TransformND> ret;
 	ret.instantiate();
@@ -444,31 +728,117 @@ Ref<TransformND> TransformND::transform_to(const Ref<TransformND> &p_to) const {
 }
 
 void TransformND::translate_global(const VectorN &p_translation) {
+	_mark_changed();
 	_origin = VectorND::add(_origin, p_translation);
 }
 
 void TransformND::translate_local(const VectorN &p_translation) {
+	_mark_changed();
 	_origin = VectorND::add(_origin, xform_basis(p_translation));
 }
 
 VectorN TransformND::xform(const VectorN &p_vector) const {
+	VectorN fixed_ret;
+	bool is_handled = false;
+	FIXED_MATRIX_ND_DISPATCH(p_vector.size(), is_handled, _xform_fixed, _columns, _origin, p_vector, fixed_ret);
+	if (is_handled) {
+		return fixed_ret;
+	}
+	InlineVectorN ret;
+	xform_into(p_vector, ret);
+	return ret.to_vector_n();
+}
+
+void TransformND::xform_into(const VectorN &p_vector, InlineVectorN &r_result) const {
 	const int dimension = MIN(p_vector.size(), _columns.size());
-	VectorN ret = _origin;
+	const double *vector_ptr = p_vector.ptr();
+	r_result.set_from_vector_n(_origin);
 	for (int i = 0; i < dimension; i++) {
-		ret = VectorND::add(ret, VectorND::multiply_scalar(_columns[i], p_vector[i]));
+		r_result.multiply_scalar_and_add_in_place(_columns[i], vector_ptr[i]);
+	}
+}
+
+// Gather the basis and origin into dense, zero-padded arrays once, so the per-vertex
+// loop only reads contiguous memory and never has to check for jagged columns.
+void TransformND::_gather_dense_xform(const int p_column_count, const int p_out_stride, InlineVectorN &r_origin, InlineVectorN &r_matrix) const {
+	r_origin.set_from_vector_n(_origin);
+	r_origin.resize(p_out_stride);
+	r_matrix.resize(0);
+	r_matrix.resize(p_column_count * p_out_stride);
+	for (int i = 0; i < p_column_count; i++) {
+		const VectorN &column = _columns[i];
+		const double *column_ptr = column.ptr();
+		for (int j = 0; j < column.size(); j++) {
+			r_matrix[i * p_out_stride + j] = column_ptr[j];
+		}
 	}
-	return ret;
 }
 
 Vector<VectorN> TransformND::xform_many(const Vector<VectorN> &p_vectors) const {
+	const int64_t vector_count = p_vectors.size();
 	Vector<VectorN> ret;
-	ret.resize(p_vectors.size());
-	for (int i = 0; i < p_vectors.size(); i++) {
-		ret.set(i, xform(p_vectors[i]));
+	ret.resize(vector_count);
+	VectorN *ret_ptrw = ret.ptrw();
+	// When every input has the same size, which is the common case, run the batch kernel directly
+	// from each input into its output, without gathering the basis again for every vector.
+	bool is_uniform = true;
+	const int64_t input_size = vector_count > 0 ? p_vectors[0].size() : 0;
+	for (int64_t i = 1; i < vector_count; i++) {
+		if (p_vectors[i].size() != input_size) {
+			is_uniform = false;
+			break;
+		}
+	}
+	if (is_uniform) {
+		const int out_stride = get_xform_output_dimension(input_size);
+		const int column_count = MIN((int)input_size, (int)_columns.size());
+		InlineVectorN origin;
+		InlineVectorN matrix;
+		_gather_dense_xform(column_count, out_stride, origin, matrix);
+		for (int64_t i = 0; i < vector_count; i++) {
+			ret_ptrw[i].resize(out_stride);
+			_xform_flat_kernel(matrix.ptr(), origin.ptr(), column_count, out_stride, p_vectors[i].ptr(), input_size, ret_ptrw[i].ptrw(), 1);
+		}
+		return ret;
+	}
+	// Reuse one scratch vector for every input, so the only allocation per vector is the output itself.
+	InlineVectorN scratch;
+	for (int64_t i = 0; i < vector_count; i++) {
+		xform_into(p_vectors[i], scratch);
+		scratch.write_to_vector_n(ret_ptrw[i]);
 	}
 	return ret;
 }
 
+int TransformND::get_xform_output_dimension(const int p_input_dimension) const {
+	// Matches the size of the VectorN that xform() would return for an input of this dimension.
+	const int column_count = MIN(p_input_dimension, (int)_columns.size());
+	int output_dimension = _origin.size();
+	for (int i = 0; i < column_count; i++) {
+		output_dimension = MAX(output_dimension, (int)_columns[i].size());
+	}
+	return output_dimension;
+}
+
+void TransformND::xform_many_flat(const PackedFloat64Array &p_vertices, const int64_t p_vertex_count, const int p_stride, PackedFloat64Array &r_transformed, int &r_out_stride) const {
+	ERR_FAIL_COND_MSG(p_vertices.size() < p_vertex_count * p_stride, "TransformND.xform_many_flat: The vertex array is too small for the given vertex count and stride.");
+	const int out_stride = get_xform_output_dimension(p_stride);
+	r_out_stride = out_stride;
+	if (r_transformed.size() != p_vertex_count * out_stride) {
+		r_transformed.resize(p_vertex_count * out_stride);
+	}
+	xform_many_flat_ptr(p_vertices.ptr(), p_vertex_count, p_stride, r_transformed.ptrw());
+}
+
+void TransformND::xform_many_flat_ptr(const double *p_vertices, const int64_t p_vertex_count, const int p_stride, double *r_transformed) const {
+	const int column_count = MIN(p_stride, (int)_columns.size());
+	const int out_stride = get_xform_output_dimension(p_stride);
+	InlineVectorN origin;
+	InlineVectorN matrix;
+	_gather_dense_xform(column_count, out_stride, origin, matrix);
+	_xform_flat_kernel(matrix.ptr(), origin.ptr(), column_count, out_stride, p_vertices, p_stride, r_transformed, p_vertex_count);
+}
+
 Ref<RectND> TransformND::xform_rect(const Ref<RectND> &p_rect) const {
 	ERR_FAIL_COND_V(p_rect.is_null(), Ref<RectND>());
 	// Computes the tight bounds of the transformed rect using interval arithmetic, generalizing
@@ -500,19 +870,21 @@ Ref<RectND> TransformND::xform_rect(const Ref<RectND> &p_rect) const {
 VectorN TransformND::xform_basis(const VectorN &p_vector) const {
 	const int column_count = _columns.size();
 	const int dimension = MIN(p_vector.size(), column_count);
-	VectorN ret;
+	const double *vector_ptr = p_vector.ptr();
+	InlineVectorN ret;
 	for (int i = 0; i < dimension; i++) {
-		VectorND::multiply_scalar_and_add_in_place(_columns[i], p_vector[i], ret);
+		ret.multiply_scalar_and_add_in_place(_columns[i], vector_ptr[i]);
 	}
-	return ret;
+	return ret.to_vector_n();
 }
 
 VectorN TransformND::xform_basis_axis(const VectorN &p_axis, const int p_axis_index) const {
 	const int column_count = _columns.size();
 	const int dimension = MIN(p_axis.size(), column_count);
-	VectorN ret;
+	const double *axis_ptr = p_axis.ptr();
+	InlineVectorN ret;
 	for (int i = 0; i < dimension; i++) {
-		VectorND::multiply_scalar_and_add_in_place(_columns[i], p_axis[i], ret);
+		ret.multiply_scalar_and_add_in_place(_columns[i], axis_ptr[i]);
 	}
 	// This is where the special case of this function comes in to handle axes.
 	// We want to treat the vector as if it had identity values in the missing dimensions.
@@ -520,9 +892,9 @@ VectorN TransformND::xform_basis_axis(const VectorN &p_axis, const int p_axis_in
 	// the identity has 1.0 in the same index as the axis. So for example, if the Z
 	// axis only has 2 numbers, we assume the third is 1.0, so we add one of the third column.
 	if (p_axis_index < column_count && p_axis_index >= p_axis.size()) {
-		VectorND::add_in_place(_columns[p_axis_index], ret);
+		ret.add_in_place(_columns[p_axis_index]);
 	}
-	return ret;
+	return ret.to_vector_n();
 }
 
 VectorN TransformND::xform_transposed(const VectorN &p_vector) const {
@@ -614,11 +986,32 @@ Vector<VectorN> TransformND::_lup_invert(const Vector<VectorN> &p_decomposed, co
 }
 
 Ref<TransformND> TransformND::inverse() const {
-	Ref<TransformND> inv = inverse_basis();
-	inv->set_origin(inv->xform_basis(VectorND::negate(_origin)));
+	Ref<TransformND> inv;
+	inv.instantiate();
+	inverse_into(inv);
 	return inv;
 }
 
+void TransformND::inverse_into(const Ref<TransformND> &r_result) const {
+	ERR_FAIL_COND(r_result.is_null());
+	const int dimension = _columns.size();
+	bool is_handled = false;
+	double fixed_columns[FIXED_MATRIX_ND_MAX_DIMENSION * FIXED_MATRIX_ND_MAX_DIMENSION];
+	double fixed_origin[FIXED_MATRIX_ND_MAX_DIMENSION];
+	FIXED_MATRIX_ND_DISPATCH(dimension, is_handled, _inverse_fixed, _columns, _origin, fixed_columns, fixed_origin);
+	if (is_handled) {
+		// Like xform_basis, an empty origin stays empty instead of becoming a zero vector.
+		r_result->_set_dense_square(fixed_columns, _origin.is_empty() ? nullptr : fixed_origin, dimension);
+		return;
+	}
+	// General path, which allocates, and also reports singular matrices.
+	Ref<TransformND> inv = inverse_basis();
+	const VectorN inv_origin = inv->xform_basis(VectorND::negate(_origin));
+	r_result->_columns = inv->_columns;
+	r_result->_origin = inv_origin;
+	r_result->_mark_changed();
+}
+
 Ref<TransformND> TransformND::inverse_basis() const {
 	const int dimension = _columns.size();
 	if (dimension <= 0) {
@@ -627,6 +1020,13 @@ Ref<TransformND> TransformND::inverse_basis() const {
 	}
 	Ref<TransformND> inv;
 	inv.instantiate();
+	Vector<VectorN> fixed_inverted;
+	bool is_handled = false;
+	FIXED_MATRIX_ND_DISPATCH(dimension, is_handled, _inverse_basis_fixed, _columns, fixed_inverted);
+	if (is_handled) {
+		inv->set_all_basis_columns(fixed_inverted);
+		return inv;
+	}
 	// Operate on a square copy of the columns (Vector<> is copy-on-write).
 	Vector<VectorN> decomposed = _columns;
 	_make_basis_square_in_place(decomposed);
@@ -688,6 +1088,7 @@ VectorN TransformND::get_scale_abs() const {
 }
 
 void TransformND::set_scale_abs(const VectorN &p_scale) {
+	_mark_changed();
 	const int64_t column_count = _columns.size();
 	for (int64_t i = 0; i < column_count; i++) {
 		const double scale = i < p_scale.size() ? p_scale[i] : 1.0;
@@ -726,6 +1127,7 @@ double TransformND::get_uniform_scale_abs() const {
 }
 
 void TransformND::scale_global(const VectorN &p_scale) {
+	_mark_changed();
 	for (int i = 0; i < _columns.size(); i++) {
 		_columns.set(i, VectorND::multiply_vector(_columns[i], p_scale));
 	}
@@ -747,6 +1149,7 @@ Ref<TransformND> TransformND::scaled_global(const VectorN &p_scale) const {
 
 void TransformND::scale_local(const VectorN &p_scale) {
 	ERR_FAIL_COND_MSG(p_scale.is_empty(), "TransformND.scale_local: Cannot scale with nothing.");
+	_mark_changed();
 	for (int i = 0; i < _columns.size(); i++) {
 		const double scale = i < p_scale.size() ? p_scale[i] : 1.0;
 		_columns.set(i, VectorND::multiply_scalar(_columns[i], scale));
@@ -768,6 +1171,7 @@ Ref<TransformND> TransformND::scaled_local(const VectorN &p_scale) const {
 }
 
 void TransformND::scale_uniform(const double p_scale) {
+	_mark_changed();
 	for (int i = 0; i < _columns.size(); i++) {
 		_columns.set(i, VectorND::multiply_scalar(_columns[i], p_scale));
 	}
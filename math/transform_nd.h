@@ -2,6 +2,7 @@
 
 #include "basis_nd.h"
 
+class InlineVectorN;
 class RectND;
 
 class TransformND : public RefCounted {
@@ -9,15 +10,27 @@ class TransformND : public RefCounted {
 
 	Vector<VectorN> _columns;
 	VectorN _origin;
+	// Incremented on every modification, so owners of a shared reference can tell when it changes.
+	uint64_t _version = 0;
+	bool _is_node_transform = false;
+
+	void _mark_changed();
 
 	static void _make_basis_square_in_place(Vector<VectorN> &p_basis);
 	static bool _lup_decompose(Vector<VectorN> &p_columns, PackedInt32Array &p_permutations, int p_dimension);
 	static Vector<VectorN> _lup_invert(const Vector<VectorN> &p_decomposed, const PackedInt32Array &p_permutations, int p_dimension);
+	void _gather_dense_xform(const int p_column_count, const int p_out_stride, InlineVectorN &r_origin, InlineVectorN &r_matrix) const;
+	void _set_dense_square(const double *p_columns, const double *p_origin, const int p_dimension);
+	static void _copy_vector_in_place(const VectorN &p_from, VectorN &r_to);
 
 protected:
 	static void _bind_methods();
 
 public:
+	uint64_t get_version() const { return _version; } // Internal use only, do not expose.
+	static uint64_t get_shared_change_count(); // Internal use only, do not expose.
+	void mark_as_node_transform() { _is_node_transform = true; } // Internal use only, do not expose.
+
 	// Getters and setters.
 	Ref<BasisND> get_basis() const;
 	void set_basis(const Ref<BasisND> &p_basis);
@@ -63,11 +76,13 @@ public:
 	// Misc methods.
 	double determinant() const;
 	Ref<TransformND> duplicate() const;
+	void copy_into(const Ref<TransformND> &r_result) const; // Internal use only, do not expose.
 	bool is_equal_approx(const Ref<TransformND> &p_other) const;
 	Ref<TransformND> lerp(const Ref<TransformND> &p_to, const double p_weight) const;
 
 	// Transformation methods.
 	Ref<TransformND> compose_square(const Ref<TransformND> &p_child_transform) const;
+	void compose_square_into(const Ref<TransformND> &p_child_transform, const Ref<TransformND> &r_result) const; // Internal use only, do not expose.
 	Ref<TransformND> compose_expand(const Ref<TransformND> &p_child_transform) const;
 	Ref<TransformND> compose_shrink(const Ref<TransformND> &p_child_transform) const;
 	Ref<TransformND> transform_to(const Ref<TransformND> &p_to) const;
@@ -76,7 +91,12 @@ public:
 	void translate_local(const VectorN &p_translation);
 
 	VectorN xform(const VectorN &p_vector) const;
+	void xform_into(const VectorN &p_vector, InlineVectorN &r_result) const;
 	Vector<VectorN> xform_many(const Vector<VectorN> &p_vectors) const;
+	int get_xform_output_dimension(const int p_input_dimension) const;
+	void xform_many_flat(const PackedFloat64Array &p_vertices, const int64_t p_vertex_count, const int p_stride, PackedFloat64Array &r_transformed, int &r_out_stride) const;
+	// Writes get_xform_output_dimension(p_stride) components per vertex into r_transformed. Internal use only, do not expose.
+	void xform_many_flat_ptr(const double *p_vertices, const int64_t p_vertex_count, const int p_stride, double *r_transformed) const;
 	Ref<RectND> xform_rect(const Ref<RectND> &p_rect) const;
 	VectorN xform_basis(const VectorN &p_vector) const;
 	VectorN xform_basis_axis(const VectorN &p_axis, const int p_axis_index) const;
@@ -85,6 +105,7 @@ public:
 
 	// Inversion methods.
 	Ref<TransformND> inverse() const;
+	void inverse_into(const Ref<TransformND> &r_result) const; // Internal use only, do not expose.
 	Ref<TransformND> inverse_basis() const;
 	Ref<TransformND> inverse_basis_transposed() const;
 	Ref<TransformND> inverse_transposed() const;
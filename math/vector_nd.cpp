@@ -1213,6 +1213,68 @@ Vector4 VectorND::to_4d(const VectorN &p_vector) {
 	return Vector4();
 }
 
+VectorN VectorND::flatten_array(const Vector<VectorN> &p_vectors, const int64_t p_stride) {
+	const int64_t vector_count = p_vectors.size();
+	VectorN flat;
+	flat.resize(vector_count * p_stride);
+	double *flat_ptrw = flat.ptrw();
+	for (int64_t vector_index = 0; vector_index < vector_count; vector_index++) {
+		// Vectors shorter than the stride are padded with zeros, longer ones are truncated.
+		const VectorN &vector = p_vectors[vector_index];
+		const int64_t copy_count = MIN(vector.size(), p_stride);
+		const double *vector_ptr = vector.ptr();
+		double *dest = flat_ptrw + vector_index * p_stride;
+		for (int64_t i = 0; i < copy_count; i++) {
+			dest[i] = vector_ptr[i];
+		}
+		for (int64_t i = copy_count; i < p_stride; i++) {
+			dest[i] = 0.0;
+		}
+	}
+	return flat;
+}
+
+Vector<VectorN> VectorND::unflatten_array(const VectorN &p_flat, const int64_t p_stride, const int64_t p_vector_count) {
+	ERR_FAIL_COND_V_MSG(p_flat.size() < p_stride * p_vector_count, Vector<VectorN>(), "VectorND.unflatten_array: The flat array is too small for the requested vector count and stride.");
+	Vector<VectorN> vectors;
+	vectors.resize(p_vector_count);
+	VectorN *vectors_ptrw = vectors.ptrw();
+	const double *flat_ptr = p_flat.ptr();
+	for (int64_t vector_index = 0; vector_index < p_vector_count; vector_index++) {
+		VectorN &vector = vectors_ptrw[vector_index];
+		vector.resize(p_stride);
+		double *vector_ptrw = vector.ptrw();
+		const double *src = flat_ptr + vector_index * p_stride;
+		for (int64_t i = 0; i < p_stride; i++) {
+			vector_ptrw[i] = src[i];
+		}
+	}
+	return vectors;
+}
+
+VectorN VectorND::restride_flat_array(const VectorN &p_flat, const int64_t p_old_stride, const int64_t p_new_stride, const int64_t p_vector_count) {
+	ERR_FAIL_COND_V_MSG(p_flat.size() < p_old_stride * p_vector_count, VectorN(), "VectorND.restride_flat_array: The flat array is too small for the requested vector count and stride.");
+	if (p_old_stride == p_new_stride) {
+		return p_flat;
+	}
+	VectorN restrided;
+	restrided.resize(p_vector_count * p_new_stride);
+	const double *old_ptr = p_flat.ptr();
+	double *new_ptrw = restrided.ptrw();
+	const int64_t copy_count = MIN(p_old_stride, p_new_stride);
+	for (int64_t vector_index = 0; vector_index < p_vector_count; vector_index++) {
+		const double *src = old_ptr + vector_index * p_old_stride;
+		double *dest = new_ptrw + vector_index * p_new_stride;
+		for (int64_t i = 0; i < copy_count; i++) {
+			dest[i] = src[i];
+		}
+		for (int64_t i = copy_count; i < p_new_stride; i++) {
+			dest[i] = 0.0;
+		}
+	}
+	return restrided;
+}
+
 String VectorND::vec_to_string(const VectorN &p_vector) {
 	String str = "(";
 	for (int64_t i = 0; i < p_vector.size(); i++) {
@@ -201,6 +201,10 @@ public:
 	static Vector2 to_2d(const VectorN &p_vector);
 	static Vector3 to_3d(const VectorN &p_vector);
 	static Vector4 to_4d(const VectorN &p_vector);
+	// Flat arrays store vectors contiguously, p_stride components each. Not exposed, C++ only.
+	static VectorN flatten_array(const Vector<VectorN> &p_vectors, const int64_t p_stride);
+	static Vector<VectorN> unflatten_array(const VectorN &p_flat, const int64_t p_stride, const int64_t p_vector_count);
+	static VectorN restride_flat_array(const VectorN &p_flat, const int64_t p_old_stride, const int64_t p_new_stride, const int64_t p_vector_count);
 	static String vec_to_string(const VectorN &p_vector);
 	static String arr_to_string(const Vector<VectorN> &p_vectors);
 	static String arr_to_string_bind(const TypedArray<VectorN> &p_vectors);
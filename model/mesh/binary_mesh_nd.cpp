@@ -0,0 +1,567 @@
+#include "binary_mesh_nd.h"
+
+#include "../../math/math_nd.h"
+#include "../../math/vector_nd.h"
+#include "cell/array_cell_mesh_nd.h"
+#include "cell/cell_material_nd.h"
+#include "wire/array_wire_mesh_nd.h"
+#include "wire/wire_material_nd.h"
+
+#if GDEXTENSION
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#elif GODOT_MODULE
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#endif
+
+#include <string.h>
+
+// Bump this whenever the layout changes, old files are rejected and need to be reimported.
+static constexpr uint32_t BINARY_MESH_FORMAT_VERSION = 2;
+// Written as a native uint32, so a file from a machine with a different byte order reads it reversed.
+static constexpr uint32_t BINARY_MESH_BYTE_ORDER_MARK = 0x01020304;
+static constexpr uint32_t BINARY_MESH_BYTE_ORDER_MARK_SWAPPED = 0x04030201;
+// Same limits as ArrayCellMeshND::set_dimension and MeshND::MAX_VERTICES, which also keep all block sizes within int64.
+static constexpr uint32_t BINARY_MESH_MAX_STRIDE = 1000;
+static constexpr uint64_t BINARY_MESH_MAX_COUNT = 2147483640;
+
+enum BinaryMeshTypeND : uint32_t {
+	BINARY_MESH_TYPE_CELL = 0,
+	BINARY_MESH_TYPE_WIRE = 1,
+};
+
+enum BinaryMeshMaterialTypeND : uint32_t {
+	BINARY_MESH_MATERIAL_TYPE_NONE = 0,
+	BINARY_MESH_MATERIAL_TYPE_CELL = 1,
+	BINARY_MESH_MATERIAL_TYPE_WIRE = 2,
+};
+
+// All fields are naturally aligned, so the struct has no padding and is written and read as-is.
+struct BinaryMeshHeaderND {
+	char magic[4] = { 'N', 'D', 'M', 'B' };
+	uint32_t format_version = BINARY_MESH_FORMAT_VERSION;
+	uint32_t byte_order_mark = BINARY_MESH_BYTE_ORDER_MARK;
+	uint32_t mesh_type = BINARY_MESH_TYPE_CELL;
+	uint32_t vertex_stride = 0;
+	uint32_t material_type = BINARY_MESH_MATERIAL_TYPE_NONE;
+	uint32_t vertex_encoding = BinaryMeshND::ENCODING_FLOAT64;
+	uint32_t normal_encoding = BinaryMeshND::ENCODING_FLOAT64;
+	uint64_t vertex_count = 0;
+	uint64_t boundary_normal_count = 0;
+	uint64_t vertex_normal_count = 0;
+	uint64_t albedo_color_count = 0;
+	uint64_t primary_index_count = 0;
+	uint64_t edge_index_count = 0;
+	uint64_t name_byte_count = 0;
+	uint32_t albedo_source_flags = 0;
+	uint32_t wire_albedo_source = 0;
+	float albedo_color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	double line_thickness = 0.0;
+
+	bool is_valid() const {
+		return memcmp(magic, "NDMB", 4) == 0 && format_version == BINARY_MESH_FORMAT_VERSION && byte_order_mark == BINARY_MESH_BYTE_ORDER_MARK && mesh_type <= BINARY_MESH_TYPE_WIRE && material_type <= BINARY_MESH_MATERIAL_TYPE_WIRE && vertex_encoding <= BinaryMeshND::ENCODING_FLOAT8 && normal_encoding <= BinaryMeshND::ENCODING_FLOAT8 && vertex_stride <= BINARY_MESH_MAX_STRIDE && vertex_count <= BINARY_MESH_MAX_COUNT && boundary_normal_count <= BINARY_MESH_MAX_COUNT && vertex_normal_count <= BINARY_MESH_MAX_COUNT && albedo_color_count <= BINARY_MESH_MAX_COUNT && primary_index_count <= BINARY_MESH_MAX_COUNT && edge_index_count <= BINARY_MESH_MAX_COUNT && name_byte_count <= BINARY_MESH_MAX_COUNT;
+	}
+
+	static int64_t get_value_size(const uint32_t p_encoding) {
+		switch (p_encoding) {
+			case BinaryMeshND::ENCODING_FLOAT16:
+				return sizeof(uint16_t);
+			case BinaryMeshND::ENCODING_FLOAT8:
+				return sizeof(uint8_t);
+			default:
+				return sizeof(double);
+		}
+	}
+
+	int64_t get_vertex_bounds_count() const {
+		return vertex_encoding == BinaryMeshND::ENCODING_FLOAT64 ? 0 : 2 * (int64_t)vertex_stride;
+	}
+
+	int64_t get_file_size() const {
+		return (int64_t)sizeof(BinaryMeshHeaderND) + (int64_t)sizeof(double) * get_vertex_bounds_count() + get_value_size(vertex_encoding) * vertex_stride * vertex_count + get_value_size(normal_encoding) * vertex_stride * (boundary_normal_count + vertex_normal_count) + (int64_t)sizeof(Color) * albedo_color_count + (int64_t)sizeof(int32_t) * (primary_index_count + edge_index_count) + (int64_t)name_byte_count;
+	}
+};
+
+static_assert(sizeof(BinaryMeshHeaderND) == 120, "BinaryMeshHeaderND must not contain padding.");
+static_assert(sizeof(Color) == 4 * sizeof(float), "Color must be 4 floats to be stored as a block.");
+
+// Reads blocks either straight from a file into the destination, or from bytes already in memory.
+class BinaryMeshReaderND {
+	Ref<FileAccess> _file;
+	const uint8_t *_data = nullptr;
+	int64_t _size = 0;
+	int64_t _position = 0;
+
+public:
+	int64_t get_size() const { return _size; }
+
+	bool read(uint8_t *r_dest, const int64_t p_byte_count) {
+		if (p_byte_count == 0) {
+			return true;
+		}
+		if (_position + p_byte_count > _size) {
+			return false;
+		}
+		if (_file.is_valid()) {
+#if GDEXTENSION
+			// godot-cpp can only read into a new PackedByteArray, so this costs one copy.
+			const PackedByteArray chunk = _file->get_buffer(p_byte_count);
+			if (chunk.size() != p_byte_count) {
+				return false;
+			}
+			memcpy(r_dest, chunk.ptr(), p_byte_count);
+#elif GODOT_MODULE
+			if ((int64_t)_file->get_buffer(r_dest, p_byte_count) != p_byte_count) {
+				return false;
+			}
+#endif
+		} else {
+			memcpy(r_dest, _data + _position, p_byte_count);
+		}
+		_position += p_byte_count;
+		return true;
+	}
+
+	// Resizes the array and reads its contents in one block.
+	template <typename TArray>
+	bool read_block(TArray &r_array, const int64_t p_element_count, const int64_t p_element_size) {
+		r_array.resize(p_element_count);
+		if (p_element_count == 0) {
+			return true;
+		}
+		return read((uint8_t *)r_array.ptrw(), p_element_count * p_element_size);
+	}
+
+	explicit BinaryMeshReaderND(const PackedByteArray &p_data) {
+		_data = p_data.ptr();
+		_size = p_data.size();
+	}
+
+	explicit BinaryMeshReaderND(const Ref<FileAccess> &p_file) {
+		_file = p_file;
+		_size = p_file->get_length();
+	}
+};
+
+static void _append_binary_mesh_block(PackedByteArray &r_bytes, int64_t &r_position, const void *p_data, const int64_t p_byte_count) {
+	if (p_byte_count > 0) {
+		ERR_FAIL_COND_MSG(r_position + p_byte_count > r_bytes.size(), "BinaryMeshND: Block does not fit in the space reserved by the header.");
+		memcpy(r_bytes.ptrw() + r_position, p_data, p_byte_count);
+		r_position += p_byte_count;
+	}
+}
+
+static void _append_binary_mesh_values(PackedByteArray &r_bytes, int64_t &r_position, const PackedFloat64Array &p_values, const uint32_t p_encoding) {
+	const int64_t count = p_values.size();
+	if (count == 0) {
+		return;
+	}
+	if (p_encoding == BinaryMeshND::ENCODING_FLOAT16) {
+		Vector<uint16_t> float16s;
+		float16s.resize(count);
+		MathND::doubles_to_float16s(p_values.ptr(), float16s.ptrw(), count);
+		_append_binary_mesh_block(r_bytes, r_position, float16s.ptr(), sizeof(uint16_t) * count);
+	} else if (p_encoding == BinaryMeshND::ENCODING_FLOAT8) {
+		ERR_FAIL_COND_MSG(r_position + count > r_bytes.size(), "BinaryMeshND: Block does not fit in the space reserved by the header.");
+		MathND::doubles_to_float8s(p_values.ptr(), r_bytes.ptrw() + r_position, count);
+		r_position += count;
+	} else {
+		_append_binary_mesh_block(r_bytes, r_position, p_values.ptr(), sizeof(double) * count);
+	}
+}
+
+// Reads a block of values in the given encoding and decodes them to doubles.
+static bool _read_binary_mesh_values(BinaryMeshReaderND &p_reader, PackedFloat64Array &r_values, const int64_t p_count, const uint32_t p_encoding) {
+	if (p_encoding == BinaryMeshND::ENCODING_FLOAT64) {
+		return p_reader.read_block(r_values, p_count, sizeof(double));
+	}
+	r_values.resize(p_count);
+	if (p_count == 0) {
+		return true;
+	}
+	if (p_encoding == BinaryMeshND::ENCODING_FLOAT16) {
+		Vector<uint16_t> float16s;
+		if (!p_reader.read_block(float16s, p_count, sizeof(uint16_t))) {
+			return false;
+		}
+		MathND::float16s_to_doubles(float16s.ptr(), r_values.ptrw(), p_count);
+	} else {
+		PackedByteArray float8s;
+		if (!p_reader.read_block(float8s, p_count, sizeof(uint8_t))) {
+			return false;
+		}
+		MathND::float8s_to_doubles(float8s.ptr(), r_values.ptrw(), p_count);
+	}
+	return true;
+}
+
+static PackedFloat64Array _decode_binary_mesh_values(const PackedFloat64Array &p_values, const uint32_t p_encoding) {
+	if (p_encoding == BinaryMeshND::ENCODING_FLOAT16) {
+		return MathND::float16_bytes_to_double_array(MathND::double_array_to_float16_bytes(p_values));
+	} else if (p_encoding == BinaryMeshND::ENCODING_FLOAT8) {
+		return MathND::float8_bytes_to_double_array(MathND::double_array_to_float8_bytes(p_values));
+	}
+	return p_values;
+}
+
+// Calculates the center of the bounds on each axis, followed by the half extent on each axis.
+// Non-finite components are ignored, they stay non-finite after normalization.
+static PackedFloat64Array _calculate_binary_mesh_vertex_bounds(const PackedFloat64Array &p_vertices_flat, const int64_t p_vertex_count, const int p_stride) {
+	PackedFloat64Array bounds;
+	bounds.resize(2 * p_stride);
+	double *bounds_ptrw = bounds.ptrw();
+	const double *vertices_ptr = p_vertices_flat.ptr();
+	for (int axis = 0; axis < p_stride; axis++) {
+		double min_value = Math_INF;
+		double max_value = -Math_INF;
+		for (int64_t i = 0; i < p_vertex_count; i++) {
+			const double value = vertices_ptr[i * p_stride + axis];
+			if (Math::is_finite(value)) {
+				min_value = MIN(min_value, value);
+				max_value = MAX(max_value, value);
+			}
+		}
+		if (min_value > max_value) {
+			min_value = 0.0;
+			max_value = 0.0;
+		}
+		bounds_ptrw[axis] = (min_value + max_value) * 0.5;
+		bounds_ptrw[p_stride + axis] = (max_value - min_value) * 0.5;
+	}
+	return bounds;
+}
+
+static PackedFloat64Array _normalize_binary_mesh_vertices(const PackedFloat64Array &p_vertices_flat, const int64_t p_vertex_count, const int p_stride, const PackedFloat64Array &p_bounds) {
+	PackedFloat64Array normalized;
+	normalized.resize(p_vertices_flat.size());
+	double *normalized_ptrw = normalized.ptrw();
+	const double *vertices_ptr = p_vertices_flat.ptr();
+	for (int64_t i = 0; i < p_vertex_count; i++) {
+		for (int axis = 0; axis < p_stride; axis++) {
+			const double value = vertices_ptr[i * p_stride + axis];
+			const double half_extent = p_bounds[p_stride + axis];
+			if (half_extent > 0.0) {
+				normalized_ptrw[i * p_stride + axis] = (value - p_bounds[axis]) / half_extent;
+			} else {
+				normalized_ptrw[i * p_stride + axis] = Math::is_finite(value) ? 0.0 : value;
+			}
+		}
+	}
+	return normalized;
+}
+
+static void _denormalize_binary_mesh_vertices(PackedFloat64Array &r_vertices_flat, const int64_t p_vertex_count, const int p_stride, const PackedFloat64Array &p_bounds) {
+	double *vertices_ptrw = r_vertices_flat.ptrw();
+	for (int64_t i = 0; i < p_vertex_count; i++) {
+		for (int axis = 0; axis < p_stride; axis++) {
+			double &value = vertices_ptrw[i * p_stride + axis];
+			const double half_extent = p_bounds[p_stride + axis];
+			if (half_extent > 0.0) {
+				value = p_bounds[axis] + value * half_extent;
+			} else if (Math::is_finite(value)) {
+				value = p_bounds[axis];
+			}
+		}
+	}
+}
+
+static void _measure_binary_mesh_error(const PackedFloat64Array &p_original_flat, const PackedFloat64Array &p_decoded_flat, const int64_t p_vector_count, const int p_stride, double &r_max_error, double &r_rms_error) {
+	r_max_error = 0.0;
+	r_rms_error = 0.0;
+	if (p_vector_count == 0) {
+		return;
+	}
+	const double *original_ptr = p_original_flat.ptr();
+	const double *decoded_ptr = p_decoded_flat.ptr();
+	double sum_squared_error = 0.0;
+	for (int64_t i = 0; i < p_vector_count; i++) {
+		double squared_error = 0.0;
+		for (int axis = 0; axis < p_stride; axis++) {
+			const double difference = decoded_ptr[i * p_stride + axis] - original_ptr[i * p_stride + axis];
+			squared_error += difference * difference;
+		}
+		sum_squared_error += squared_error;
+		r_max_error = MAX(r_max_error, Math::sqrt(squared_error));
+	}
+	r_rms_error = Math::sqrt(sum_squared_error / p_vector_count);
+}
+
+PackedByteArray BinaryMeshND::save_to_byte_array(const Ref<MeshND> &p_mesh, const Encoding p_encoding, QuantizationReport *r_report) {
+	ERR_FAIL_COND_V_MSG(p_mesh.is_null(), PackedByteArray(), "BinaryMeshND: Cannot save a null mesh.");
+	BinaryMeshHeaderND header;
+	// The header sizes the vertex block, so its count must come from the same flat array that is written.
+	PackedFloat64Array vertices_flat;
+	int64_t vertex_count = 0;
+	int vertex_stride = 0;
+	ERR_FAIL_COND_V_MSG(!p_mesh->get_vertices_flat_checked(vertices_flat, vertex_count, vertex_stride), PackedByteArray(), "BinaryMeshND: Cannot save a mesh with inconsistent vertex data.");
+	header.vertex_count = vertex_count;
+	header.vertex_stride = vertex_stride;
+	ERR_FAIL_COND_V_MSG(header.vertex_stride > BINARY_MESH_MAX_STRIDE, PackedByteArray(), "BinaryMeshND: Too many dimensions to save.");
+	PackedFloat64Array boundary_normals_flat;
+	PackedFloat64Array vertex_normals_flat;
+	PackedInt32Array primary_indices;
+	PackedInt32Array edge_indices;
+	CellMeshND *cell_mesh = Object::cast_to<CellMeshND>(p_mesh.ptr());
+	if (cell_mesh) {
+		header.mesh_type = BINARY_MESH_TYPE_CELL;
+		primary_indices = cell_mesh->get_simplex_cell_indices();
+		// Deriving the edges is the expensive part of preparing a cell mesh for rendering, so store them too.
+		edge_indices = cell_mesh->get_edge_indices();
+		const Vector<VectorN> boundary_normals = cell_mesh->get_simplex_cell_boundary_normals();
+		const Vector<VectorN> vertex_normals = cell_mesh->get_simplex_cell_vertex_normals();
+		header.boundary_normal_count = boundary_normals.size();
+		header.vertex_normal_count = vertex_normals.size();
+		boundary_normals_flat = VectorND::flatten_array(boundary_normals, header.vertex_stride);
+		vertex_normals_flat = VectorND::flatten_array(vertex_normals, header.vertex_stride);
+	} else {
+		ERR_FAIL_COND_V_MSG(!Object::cast_to<WireMeshND>(p_mesh.ptr()), PackedByteArray(), "BinaryMeshND: Only cell meshes and wire meshes can be saved.");
+		header.mesh_type = BINARY_MESH_TYPE_WIRE;
+		primary_indices = p_mesh->get_edge_indices();
+	}
+	header.primary_index_count = primary_indices.size();
+	header.edge_index_count = edge_indices.size();
+	PackedColorArray albedo_colors;
+	const Ref<MaterialND> material = p_mesh->get_material();
+	if (material.is_valid()) {
+		const Ref<WireMaterialND> wire_material = material;
+		if (wire_material.is_valid()) {
+			header.material_type = BINARY_MESH_MATERIAL_TYPE_WIRE;
+			header.wire_albedo_source = wire_material->get_albedo_source();
+			header.line_thickness = wire_material->get_line_thickness();
+		} else {
+			ERR_FAIL_COND_V_MSG(!Object::cast_to<CellMaterialND>(material.ptr()), PackedByteArray(), "BinaryMeshND: Only cell materials and wire materials can be saved.");
+			header.material_type = BINARY_MESH_MATERIAL_TYPE_CELL;
+		}
+		header.albedo_source_flags = material->get_albedo_source_flags();
+		const Color albedo_color = material->get_albedo_color();
+		header.albedo_color[0] = albedo_color.r;
+		header.albedo_color[1] = albedo_color.g;
+		header.albedo_color[2] = albedo_color.b;
+		header.albedo_color[3] = albedo_color.a;
+		albedo_colors = material->get_albedo_color_array();
+		header.albedo_color_count = albedo_colors.size();
+	}
+	const CharString name_utf8 = p_mesh->get_name().utf8();
+	header.name_byte_count = name_utf8.length();
+	if (r_report) {
+		*r_report = QuantizationReport();
+		r_report->unquantized_byte_count = header.get_file_size();
+	}
+	header.vertex_encoding = p_encoding;
+	header.normal_encoding = p_encoding;
+	PackedFloat64Array vertex_bounds;
+	PackedFloat64Array vertices_to_encode = vertices_flat;
+	if (p_encoding != ENCODING_FLOAT64) {
+		vertex_bounds = _calculate_binary_mesh_vertex_bounds(vertices_flat, header.vertex_count, header.vertex_stride);
+		vertices_to_encode = _normalize_binary_mesh_vertices(vertices_flat, header.vertex_count, header.vertex_stride, vertex_bounds);
+		if (r_report) {
+			PackedFloat64Array decoded_vertices = _decode_binary_mesh_values(vertices_to_encode, p_encoding);
+			_denormalize_binary_mesh_vertices(decoded_vertices, header.vertex_count, header.vertex_stride, vertex_bounds);
+			_measure_binary_mesh_error(vertices_flat, decoded_vertices, header.vertex_count, header.vertex_stride, r_report->max_vertex_error, r_report->rms_vertex_error);
+			// Normals are already on [-1, 1], so they are quantized as-is.
+			PackedFloat64Array normals_flat = boundary_normals_flat;
+			normals_flat.append_array(vertex_normals_flat);
+			_measure_binary_mesh_error(normals_flat, _decode_binary_mesh_values(normals_flat, p_encoding), header.boundary_normal_count + header.vertex_normal_count, header.vertex_stride, r_report->max_normal_error, r_report->rms_normal_error);
+		}
+	}
+	PackedByteArray bytes;
+	bytes.resize(header.get_file_size());
+	int64_t position = 0;
+	_append_binary_mesh_block(bytes, position, &header, sizeof(BinaryMeshHeaderND));
+	_append_binary_mesh_block(bytes, position, vertex_bounds.ptr(), sizeof(double) * vertex_bounds.size());
+	_append_binary_mesh_values(bytes, position, vertices_to_encode, header.vertex_encoding);
+	_append_binary_mesh_values(bytes, position, boundary_normals_flat, header.normal_encoding);
+	_append_binary_mesh_values(bytes, position, vertex_normals_flat, header.normal_encoding);
+	_append_binary_mesh_block(bytes, position, albedo_colors.ptr(), sizeof(Color) * albedo_colors.size());
+	_append_binary_mesh_block(bytes, position, primary_indices.ptr(), sizeof(int32_t) * primary_indices.size());
+	_append_binary_mesh_block(bytes, position, edge_indices.ptr(), sizeof(int32_t) * edge_indices.size());
+	_append_binary_mesh_block(bytes, position, name_utf8.get_data(), header.name_byte_count);
+	DEV_ASSERT(position == bytes.size());
+	if (r_report) {
+		r_report->byte_count = bytes.size();
+	}
+	return bytes;
+}
+
+Error BinaryMeshND::save_to_file(const Ref<MeshND> &p_mesh, const String &p_path, const Encoding p_encoding, QuantizationReport *r_report) {
+	const PackedByteArray bytes = save_to_byte_array(p_mesh, p_encoding, r_report);
+	ERR_FAIL_COND_V(bytes.is_empty(), ERR_INVALID_DATA);
+	const String base_dir = ProjectSettings::get_singleton()->globalize_path(p_path.get_base_dir());
+	if (!base_dir.is_empty()) {
+		Error dir_err = DirAccess::make_dir_recursive_absolute(base_dir);
+		ERR_FAIL_COND_V_MSG(dir_err != OK, dir_err, "BinaryMeshND: Failed to create base directory for file: " + base_dir);
+	}
+#if GDEXTENSION
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_FILE_CANT_WRITE, "BinaryMeshND: Could not open file " + p_path + " for writing.");
+#elif GODOT_MODULE
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "BinaryMeshND: Could not open file " + p_path + " for writing.");
+#endif
+	file->store_buffer(bytes);
+	file->close();
+	return OK;
+}
+
+Ref<MeshND> BinaryMeshND::_load_from_reader(BinaryMeshReaderND &p_reader, const String &p_path, Error *r_error) {
+	if (r_error) {
+		*r_error = ERR_FILE_CORRUPT;
+	}
+	BinaryMeshHeaderND header;
+	ERR_FAIL_COND_V_MSG(!p_reader.read((uint8_t *)&header, sizeof(BinaryMeshHeaderND)), Ref<MeshND>(), "BinaryMeshND: File " + p_path + " is too small to be a binary ND mesh.");
+	ERR_FAIL_COND_V_MSG(memcmp(header.magic, "NDMB", 4) != 0, Ref<MeshND>(), "BinaryMeshND: File " + p_path + " is not a binary ND mesh.");
+	ERR_FAIL_COND_V_MSG(header.byte_order_mark == BINARY_MESH_BYTE_ORDER_MARK_SWAPPED, Ref<MeshND>(), "BinaryMeshND: File " + p_path + " was saved with a different byte order, reimport it on this machine.");
+	ERR_FAIL_COND_V_MSG(header.format_version != BINARY_MESH_FORMAT_VERSION, Ref<MeshND>(), "BinaryMeshND: File " + p_path + " has an unsupported format version, reimport it.");
+	ERR_FAIL_COND_V_MSG(!header.is_valid(), Ref<MeshND>(), "BinaryMeshND: File " + p_path + " has an invalid header.");
+	ERR_FAIL_COND_V_MSG(header.get_file_size() != p_reader.get_size(), Ref<MeshND>(), "BinaryMeshND: File " + p_path + " does not match the size given in its header.");
+	// Read every block straight into the buffer the mesh keeps, in file order.
+	PackedFloat64Array vertex_bounds;
+	PackedFloat64Array vertices_flat;
+	PackedFloat64Array boundary_normals_flat;
+	PackedFloat64Array vertex_normals_flat;
+	PackedColorArray albedo_colors;
+	PackedInt32Array primary_indices;
+	PackedInt32Array edge_indices;
+	PackedByteArray name_utf8;
+	bool read_ok = p_reader.read_block(vertex_bounds, header.get_vertex_bounds_count(), sizeof(double));
+	read_ok = read_ok && _read_binary_mesh_values(p_reader, vertices_flat, header.vertex_count * header.vertex_stride, header.vertex_encoding);
+	read_ok = read_ok && _read_binary_mesh_values(p_reader, boundary_normals_flat, header.boundary_normal_count * header.vertex_stride, header.normal_encoding);
+	read_ok = read_ok && _read_binary_mesh_values(p_reader, vertex_normals_flat, header.vertex_normal_count * header.vertex_stride, header.normal_encoding);
+	read_ok = read_ok && p_reader.read_block(albedo_colors, header.albedo_color_count, sizeof(Color));
+	read_ok = read_ok && p_reader.read_block(primary_indices, header.primary_index_count, sizeof(int32_t));
+	read_ok = read_ok && p_reader.read_block(edge_indices, header.edge_index_count, sizeof(int32_t));
+	read_ok = read_ok && p_reader.read_block(name_utf8, header.name_byte_count, 1);
+	ERR_FAIL_COND_V_MSG(!read_ok, Ref<MeshND>(), "BinaryMeshND: Failed to read the data of file " + p_path + ".");
+	if (!vertex_bounds.is_empty()) {
+		_denormalize_binary_mesh_vertices(vertices_flat, header.vertex_count, header.vertex_stride, vertex_bounds);
+	}
+	Ref<MeshND> mesh;
+	if (header.mesh_type == BINARY_MESH_TYPE_CELL) {
+		Ref<ArrayCellMeshND> cell_mesh;
+		cell_mesh.instantiate();
+		cell_mesh->set_vertices_flat(vertices_flat, header.vertex_count, header.vertex_stride);
+		cell_mesh->set_simplex_cell_indices(primary_indices);
+		if (header.boundary_normal_count > 0) {
+			cell_mesh->set_cell_boundary_normals(VectorND::unflatten_array(boundary_normals_flat, header.vertex_stride, header.boundary_normal_count));
+		}
+		if (header.vertex_normal_count > 0) {
+			cell_mesh->set_simplex_cell_vertex_normals(VectorND::unflatten_array(vertex_normals_flat, header.vertex_stride, header.vertex_normal_count));
+		}
+		cell_mesh->set_edge_indices_cache(edge_indices);
+		mesh = cell_mesh;
+	} else {
+		Ref<ArrayWireMeshND> wire_mesh;
+		wire_mesh.instantiate();
+		wire_mesh->set_vertices_flat(vertices_flat, header.vertex_count, header.vertex_stride);
+		wire_mesh->set_edge_indices(primary_indices);
+		mesh = wire_mesh;
+	}
+	if (header.material_type != BINARY_MESH_MATERIAL_TYPE_NONE) {
+		Ref<MaterialND> material;
+		if (header.material_type == BINARY_MESH_MATERIAL_TYPE_WIRE) {
+			Ref<WireMaterialND> wire_material;
+			wire_material.instantiate();
+			wire_material->set_albedo_source(WireMaterialND::WireColorSourceND(header.wire_albedo_source));
+			wire_material->set_line_thickness(header.line_thickness);
+			material = wire_material;
+		} else {
+			Ref<CellMaterialND> cell_material;
+			cell_material.instantiate();
+			material = cell_material;
+		}
+		material->set_albedo_source_flags(MaterialND::ColorSourceFlagsND(header.albedo_source_flags));
+		material->set_albedo_color(Color(header.albedo_color[0], header.albedo_color[1], header.albedo_color[2], header.albedo_color[3]));
+		material->set_albedo_color_array(albedo_colors);
+		mesh->set_material(material);
+	}
+	if (header.name_byte_count > 0) {
+		mesh->set_name(String::utf8((const char *)name_utf8.ptr(), header.name_byte_count));
+	}
+	if (r_error) {
+		*r_error = OK;
+	}
+	return mesh;
+}
+
+Ref<MeshND> BinaryMeshND::load_from_byte_array(const PackedByteArray &p_data, Error *r_error) {
+	BinaryMeshReaderND reader = BinaryMeshReaderND(p_data);
+	return _load_from_reader(reader, "(in-memory data)", r_error);
+}
+
+Ref<MeshND> BinaryMeshND::load_from_file(const String &p_path, Error *r_error) {
+	if (r_error) {
+		*r_error = ERR_FILE_CANT_OPEN;
+	}
+#if GDEXTENSION
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(file.is_null(), Ref<MeshND>(), "BinaryMeshND: Could not open file " + p_path + ".");
+#elif GODOT_MODULE
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, Ref<MeshND>(), "BinaryMeshND: Could not open file " + p_path + ".");
+#endif
+	BinaryMeshReaderND reader = BinaryMeshReaderND(file);
+	return _load_from_reader(reader, p_path, r_error);
+}
+
+String BinaryMeshND::get_mesh_type_of_file(const String &p_path) {
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+	if (file.is_null()) {
+		return String();
+	}
+	BinaryMeshHeaderND header;
+	BinaryMeshReaderND reader = BinaryMeshReaderND(file);
+	if (!reader.read((uint8_t *)&header, sizeof(BinaryMeshHeaderND)) || !header.is_valid()) {
+		return String();
+	}
+	return header.mesh_type == BINARY_MESH_TYPE_CELL ? "ArrayCellMeshND" : "ArrayWireMeshND";
+}
+
+#if GDEXTENSION
+PackedStringArray ResourceFormatLoaderBinaryMeshND::_get_recognized_extensions() const {
+	return PackedStringArray{ "ndmesh" };
+}
+
+bool ResourceFormatLoaderBinaryMeshND::_handles_type(const StringName &p_type) const {
+	return ClassDB::is_parent_class("ArrayCellMeshND", p_type) || ClassDB::is_parent_class("ArrayWireMeshND", p_type);
+}
+
+String ResourceFormatLoaderBinaryMeshND::_get_resource_type(const String &p_path) const {
+	if (p_path.get_extension().to_lower() != "ndmesh") {
+		return String();
+	}
+	return BinaryMeshND::get_mesh_type_of_file(p_path);
+}
+
+Variant ResourceFormatLoaderBinaryMeshND::_load(const String &p_path, const String &p_original_path, bool p_use_sub_threads, int32_t p_cache_mode) const {
+	Error err = OK;
+	Ref<MeshND> mesh = BinaryMeshND::load_from_file(p_path, &err);
+	if (err != OK) {
+		return err;
+	}
+	return mesh;
+}
+#elif GODOT_MODULE
+void ResourceFormatLoaderBinaryMeshND::get_recognized_extensions(List<String> *p_extensions) const {
+	p_extensions->push_back("ndmesh");
+}
+
+bool ResourceFormatLoaderBinaryMeshND::handles_type(const String &p_type) const {
+	return ClassDB::is_parent_class("ArrayCellMeshND", p_type) || ClassDB::is_parent_class("ArrayWireMeshND", p_type);
+}
+
+String ResourceFormatLoaderBinaryMeshND::get_resource_type(const String &p_path) const {
+	if (p_path.get_extension().to_lower() != "ndmesh") {
+		return String();
+	}
+	return BinaryMeshND::get_mesh_type_of_file(p_path);
+}
+
+Ref<Resource> ResourceFormatLoaderBinaryMeshND::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
+	return BinaryMeshND::load_from_file(p_path, r_error);
+}
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "mesh_nd.h"
+
+#if GDEXTENSION
+#include <godot_cpp/classes/resource_format_loader.hpp>
+#elif GODOT_MODULE
+#include "core/io/resource_loader.h"
+#endif
+
+class BinaryMeshReaderND;
+
+// Compact binary cache format for imported meshes, with the file extension ".ndmesh".
+// Unlike a regular resource, vertices and normals are stored as flat blocks of doubles and indices
+// as blocks of int32, in the same memory layout ArrayCellMeshND and ArrayWireMeshND use, so loading
+// reads each block straight into its final buffer instead of deserializing one Variant per vertex.
+// Cell meshes also store their edge indices, so they don't need to be derived again on first render.
+// Vertices and normals can optionally be quantized to float16 or float8, see BinaryMeshND::Encoding.
+//
+// Layout, all in the native byte order of the machine that saved it. The header's byte order mark
+// (BINARY_MESH_BYTE_ORDER_MARK in the cpp file) is checked on load, so a file saved on a machine with
+// a different byte order is rejected and needs to be reimported:
+// - Header, see BinaryMeshHeaderND in the cpp file.
+// - If the vertices are quantized, the center and half extent of their bounds on each axis, as doubles.
+// - Vertices, vertex count times stride values.
+// - Simplex cell boundary normals and vertex normals, stride values each.
+// - Albedo colors, 4 floats each.
+// - Primary indices, which are simplex cell indices for cell meshes and edge indices for wire meshes.
+// - Cell mesh edge indices.
+// - Resource name as UTF-8.
+class BinaryMeshND {
+public:
+	// How vertices and normals are stored. Quantized vertices are normalized to the bounds of the mesh on
+	// each axis first, so the precision is spread over the mesh instead of being concentrated at the origin.
+	enum Encoding : uint32_t {
+		ENCODING_FLOAT64,
+		ENCODING_FLOAT16,
+		ENCODING_FLOAT8,
+	};
+
+	// Filled in when saving, by decoding the saved values again and comparing them to the mesh.
+	// Errors are Euclidean distances per vertex or normal, in the units of the mesh.
+	struct QuantizationReport {
+		double max_vertex_error = 0.0;
+		double rms_vertex_error = 0.0;
+		double max_normal_error = 0.0;
+		double rms_normal_error = 0.0;
+		int64_t byte_count = 0;
+		int64_t unquantized_byte_count = 0;
+	};
+
+private:
+	static Ref<MeshND> _load_from_reader(BinaryMeshReaderND &p_reader, const String &p_path, Error *r_error);
+
+public:
+	static PackedByteArray save_to_byte_array(const Ref<MeshND> &p_mesh, const Encoding p_encoding = ENCODING_FLOAT64, QuantizationReport *r_report = nullptr);
+	static Error save_to_file(const Ref<MeshND> &p_mesh, const String &p_path, const Encoding p_encoding = ENCODING_FLOAT64, QuantizationReport *r_report = nullptr);
+	static Ref<MeshND> load_from_byte_array(const PackedByteArray &p_data, Error *r_error = nullptr);
+	static Ref<MeshND> load_from_file(const String &p_path, Error *r_error = nullptr);
+	// Returns "ArrayCellMeshND" or "ArrayWireMeshND" by reading only the header, or an empty string if the file is not valid.
+	static String get_mesh_type_of_file(const String &p_path);
+};
+
+class ResourceFormatLoaderBinaryMeshND : public ResourceFormatLoader {
+	GDCLASS(ResourceFormatLoaderBinaryMeshND, ResourceFormatLoader);
+
+protected:
+	static void _bind_methods() {}
+
+public:
+#if GDEXTENSION
+	virtual PackedStringArray _get_recognized_extensions() const override;
+	virtual bool _handles_type(const StringName &p_type) const override;
+	virtual String _get_resource_type(const String &p_path) const override;
+	virtual Variant _load(const String &p_path, const String &p_original_path, bool p_use_sub_threads, int32_t p_cache_mode) const override;
+#elif GODOT_MODULE
+	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
+	virtual bool handles_type(const String &p_type) const override;
+	virtual String get_resource_type(const String &p_path) const override;
+	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
+#endif
+};
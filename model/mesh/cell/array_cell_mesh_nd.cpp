@@ -7,6 +7,11 @@ void ArrayCellMeshND::_clear_cache() {
 	cell_mesh_clear_cache();
 }
 
+void ArrayCellMeshND::_set_vertex_stride(const int p_stride) {
+	_vertices_flat = VectorND::restride_flat_array(_vertices_flat, _vertex_stride, p_stride, _vertex_count);
+	_vertex_stride = p_stride;
+}
+
 bool ArrayCellMeshND::validate_mesh_data() {
 	const int64_t cell_indices_count = _simplex_cell_indices.size();
 	const int dimension = get_dimension();
@@ -15,7 +20,7 @@ bool ArrayCellMeshND::validate_mesh_data() {
 	ERR_FAIL_COND_V_MSG(cell_boundary_normals_count > 0 && cell_boundary_normals_count * dimension != cell_indices_count, false, "ArrayCellMeshND: Simplex cell boundary normals size must be one dimension-th of simplex cell indices size (or empty).");
 	const int64_t cell_vertex_normals_count = _simplex_cell_vertex_normals.size();
 	ERR_FAIL_COND_V_MSG(cell_vertex_normals_count > 0 && cell_vertex_normals_count != cell_indices_count, false, "ArrayCellMeshND: Simplex cell vertex normals size must be the same as simplex cell indices size (or empty).");
-	const int64_t vertex_count = _vertices.size();
+	const int64_t vertex_count = _vertex_count;
 	for (int32_t cell_index : _simplex_cell_indices) {
 		ERR_FAIL_COND_V_MSG(cell_index < 0 || cell_index >= vertex_count, false, "ArrayCellMeshND: Simplex cell indices must reference valid vertices.");
 	}
@@ -23,15 +28,34 @@ bool ArrayCellMeshND::validate_mesh_data() {
 }
 
 int ArrayCellMeshND::append_vertex(const VectorN &p_vertex, const bool p_deduplicate_vertices) {
-	const int64_t vertex_count = _vertices.size();
+	const int64_t vertex_count = _vertex_count;
+	const int64_t input_size = p_vertex.size();
+	const double *input_ptr = p_vertex.ptr();
 	if (p_deduplicate_vertices) {
-		for (int64_t i = 0; i < vertex_count; i++) {
-			if (VectorND::is_equal_exact(_vertices[i], p_vertex)) {
-				return i;
-			}
+		if (!_vertex_lookup.is_built()) {
+			_vertex_lookup.build(_vertices_flat.ptr(), _vertex_count, _vertex_stride);
+		}
+		// Equivalent to VectorND::is_equal_exact, where missing components are treated as zero.
+		const int64_t existing_index = _vertex_lookup.find(_vertices_flat.ptr(), _vertex_stride, input_ptr, input_size, false);
+		if (existing_index >= 0) {
+			return existing_index;
 		}
 	}
-	_vertices.push_back(p_vertex);
+	if (input_size > _vertex_stride) {
+		// Existing vertices get padded, so cached positions derived from them are stale.
+		_set_vertex_stride(input_size);
+		_clear_cache();
+	}
+	_vertices_flat.resize((_vertex_count + 1) * _vertex_stride);
+	double *dest = _vertices_flat.ptrw() + _vertex_count * _vertex_stride;
+	for (int64_t axis = 0; axis < _vertex_stride; axis++) {
+		dest[axis] = axis < input_size ? input_ptr[axis] : 0.0;
+	}
+	_vertex_count++;
+	if (_vertex_lookup.is_built()) {
+		_vertex_lookup.insert(dest, _vertex_stride, vertex_count);
+	}
+	mark_rect_bounds_dirty();
 	reset_mesh_data_validation();
 	return vertex_count;
 }
@@ -49,23 +73,36 @@ void ArrayCellMeshND::merge_with(const Ref<ArrayCellMeshND> &p_other, const Ref<
 	const int64_t start_cell_index_count = _simplex_cell_indices.size();
 	const int64_t start_cell_face_normal_count = _simplex_cell_boundary_normals.size();
 	const int64_t start_cell_vertex_normal_count = _simplex_cell_vertex_normals.size();
-	const int64_t start_vertex_count = _vertices.size();
+	const int64_t start_vertex_count = _vertex_count;
 	const int64_t other_cell_index_count = p_other->_simplex_cell_indices.size();
 	const int64_t other_cell_face_normal_count = p_other->_simplex_cell_boundary_normals.size();
 	const int64_t other_cell_vertex_normal_count = p_other->_simplex_cell_vertex_normals.size();
-	const int64_t other_vertex_count = p_other->_vertices.size();
+	const int64_t other_vertex_count = p_other->_vertex_count;
 	const int64_t end_cell_index_count = start_cell_index_count + other_cell_index_count;
-	const int64_t end_vertex_count = start_vertex_count + other_vertex_count;
-	const int64_t dimension = get_dimension();
 	_simplex_cell_indices.resize(end_cell_index_count);
-	_vertices.resize(end_vertex_count);
 	// Copy in the cell indices and vertices from the other mesh.
 	for (int64_t i = 0; i < other_cell_index_count; i++) {
 		_simplex_cell_indices.set(start_cell_index_count + i, p_other->_simplex_cell_indices[i] + start_vertex_count);
 	}
+	PackedFloat64Array other_transformed;
+	int other_stride = 0;
+	p_transform->xform_many_flat(p_other->_vertices_flat, other_vertex_count, p_other->_vertex_stride, other_transformed, other_stride);
+	if (other_stride > _vertex_stride) {
+		_set_vertex_stride(other_stride);
+	}
+	_vertices_flat.resize((start_vertex_count + other_vertex_count) * _vertex_stride);
+	const double *src = other_transformed.ptr();
+	double *dest = _vertices_flat.ptrw() + start_vertex_count * _vertex_stride;
 	for (int64_t i = 0; i < other_vertex_count; i++) {
-		_vertices.set(start_vertex_count + i, p_transform->xform(p_other->_vertices[i]));
+		for (int axis = 0; axis < _vertex_stride; axis++) {
+			dest[axis] = axis < other_stride ? src[axis] : 0.0;
+		}
+		src += other_stride;
+		dest += _vertex_stride;
 	}
+	_vertex_count = start_vertex_count + other_vertex_count;
+	_vertex_lookup.clear();
+	const int64_t dimension = get_dimension();
 	// Can't simply add these together in case the first mesh has no normals.
 	if (start_cell_face_normal_count > 0 || other_cell_face_normal_count > 0) {
 		const int64_t end_cell_normal_count = end_cell_index_count / dimension;
@@ -162,21 +199,37 @@ void ArrayCellMeshND::set_simplex_cell_vertex_normals_bind(const TypedArray<Vect
 }
 
 Vector<VectorN> ArrayCellMeshND::get_vertices() {
-	return _vertices;
+	return VectorND::unflatten_array(_vertices_flat, _vertex_stride, _vertex_count);
 }
 
 void ArrayCellMeshND::set_vertices(const Vector<VectorN> &p_vertices) {
-	_vertices = p_vertices;
+	int stride = 0;
+	for (const VectorN &vertex : p_vertices) {
+		stride = MAX(stride, (int)vertex.size());
+	}
+	_vertices_flat = VectorND::flatten_array(p_vertices, stride);
+	_vertex_count = p_vertices.size();
+	_vertex_stride = stride;
+	_vertex_lookup.clear();
 	_clear_cache();
 	reset_mesh_data_validation();
 }
 
 void ArrayCellMeshND::set_vertices_bind(const TypedArray<VectorN> &p_vertices) {
-	_vertices.clear();
-	_vertices.resize(p_vertices.size());
+	Vector<VectorN> vertices;
+	vertices.resize(p_vertices.size());
 	for (int i = 0; i < p_vertices.size(); i++) {
-		_vertices.set(i, p_vertices[i]);
+		vertices.set(i, p_vertices[i]);
 	}
+	set_vertices(vertices);
+}
+
+void ArrayCellMeshND::set_vertices_flat(const PackedFloat64Array &p_vertices_flat, const int64_t p_vertex_count, const int p_stride) {
+	ERR_FAIL_COND_MSG(p_vertices_flat.size() != p_vertex_count * p_stride, "ArrayCellMeshND: Flat vertex array size must be the vertex count times the stride.");
+	_vertices_flat = p_vertices_flat;
+	_vertex_count = p_vertex_count;
+	_vertex_stride = p_stride;
+	_vertex_lookup.clear();
 	_clear_cache();
 	reset_mesh_data_validation();
 }
@@ -184,9 +237,8 @@ void ArrayCellMeshND::set_vertices_bind(const TypedArray<VectorN> &p_vertices) {
 void ArrayCellMeshND::set_dimension(int p_dimension) {
 	ERR_FAIL_COND_MSG(p_dimension < 0, "ArrayCellMeshND: Dimension must not be negative.");
 	ERR_FAIL_COND_MSG(p_dimension > 1000, "ArrayCellMeshND: Too many dimensions for cell mesh.");
-	for (int i = 0; i < _vertices.size(); i++) {
-		_vertices.set(i, VectorND::with_dimension(_vertices[i], p_dimension));
-	}
+	_set_vertex_stride(p_dimension);
+	_vertex_lookup.clear();
 	_clear_cache();
 	reset_mesh_data_validation();
 }
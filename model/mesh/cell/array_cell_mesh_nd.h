@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../../math/transform_nd.h"
+#include "../vertex_lookup_nd.h"
 #include "cell_mesh_nd.h"
 
 class ArrayCellMeshND : public CellMeshND {
@@ -9,9 +10,15 @@ class ArrayCellMeshND : public CellMeshND {
 	PackedInt32Array _simplex_cell_indices;
 	Vector<VectorN> _simplex_cell_boundary_normals;
 	Vector<VectorN> _simplex_cell_vertex_normals;
-	Vector<VectorN> _vertices;
+	// Vertices are stored flat, _vertex_stride components each, see MeshND::get_vertices_flat().
+	PackedFloat64Array _vertices_flat;
+	int64_t _vertex_count = 0;
+	int _vertex_stride = 0;
+	// Index for deduplicating appended vertices, built on first use and cleared when existing vertices change.
+	VertexLookupND _vertex_lookup;
 
 	void _clear_cache();
+	void _set_vertex_stride(const int p_stride);
 
 protected:
 	static void _bind_methods();
@@ -37,5 +44,11 @@ public:
 	virtual Vector<VectorN> get_vertices() override;
 	void set_vertices(const Vector<VectorN> &p_vertices);
 	void set_vertices_bind(const TypedArray<VectorN> &p_vertices);
+	virtual int get_dimension() override { return _vertex_stride; }
 	void set_dimension(int p_dimension);
+
+	virtual PackedFloat64Array get_vertices_flat() override { return _vertices_flat; }
+	virtual int64_t get_vertex_count() override { return _vertex_count; }
+	virtual int get_vertex_stride() override { return _vertex_stride; }
+	void set_vertices_flat(const PackedFloat64Array &p_vertices_flat, const int64_t p_vertex_count, const int p_stride);
 };
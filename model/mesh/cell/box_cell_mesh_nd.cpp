@@ -9,6 +9,7 @@ void BoxCellMeshND::_clear_caches() {
 	_cell_indices_cache.clear();
 	_vertices_cache.clear();
 	cell_mesh_clear_cache();
+	reset_mesh_data_validation();
 }
 
 VectorN BoxCellMeshND::get_half_extents() const {
@@ -16,7 +17,7 @@ VectorN BoxCellMeshND::get_half_extents() const {
 }
 
 void BoxCellMeshND::set_half_extents(const VectorN &p_half_extents) {
-	ERR_FAIL_COND_MSG(p_half_extents.size() > 10, "BoxCellMeshND: Too many dimensions for cell-based box.");
+	ERR_FAIL_COND_MSG(p_half_extents.size() > 12, "BoxCellMeshND: Too many dimensions for cell-based box.");
 	_size = VectorND::multiply_scalar(p_half_extents, 2.0);
 	_clear_caches();
 }
@@ -26,14 +27,14 @@ VectorN BoxCellMeshND::get_size() const {
 }
 
 void BoxCellMeshND::set_size(const VectorN &p_size) {
-	ERR_FAIL_COND_MSG(p_size.size() > 10, "BoxCellMeshND: Too many dimensions for cell-based box.");
+	ERR_FAIL_COND_MSG(p_size.size() > 12, "BoxCellMeshND: Too many dimensions for cell-based box.");
 	_size = p_size;
 	_clear_caches();
 }
 
 void BoxCellMeshND::set_dimension(int p_dimension) {
 	ERR_FAIL_COND_MSG(p_dimension < 0, "BoxCellMeshND: Dimension must not be negative.");
-	ERR_FAIL_COND_MSG(p_dimension > 10, "BoxCellMeshND: Too many dimensions for cell-based box.");
+	ERR_FAIL_COND_MSG(p_dimension > 12, "BoxCellMeshND: Too many dimensions for cell-based box.");
 	_size = VectorND::with_dimension(_size, p_dimension);
 	_clear_caches();
 }
@@ -43,42 +44,125 @@ void BoxCellMeshND::set_polytope_cells(const bool p_polytope_cells) {
 	_clear_caches();
 }
 
-int64_t BoxCellMeshND::_factorial(const int64_t p_dimension) {
+void BoxCellMeshND::set_surface_only(const bool p_surface_only) {
+	_surface_only = p_surface_only;
+	_clear_caches();
+}
+
+int64_t BoxCellSimplexCursorND::factorial(const int64_t p_number) {
 	int64_t result = 1;
-	for (int64_t i = 2; i <= p_dimension; i++) {
+	for (int64_t i = 2; i <= p_number; i++) {
 		result *= i;
 	}
 	return result;
 }
 
-void BoxCellMeshND::_write_gray_path(const int64_t p_dimension, const int64_t p_index, const int64_t *p_bit_order, PackedInt32Array &r_out) {
-	const int64_t offset = p_index * (p_dimension + 1);
-	int64_t value = 0;
-	r_out.set(offset, value);
-	for (int64_t i = 0; i < p_dimension; ++i) {
-		value ^= (int64_t(1) << int64_t(p_bit_order[i]));
-		r_out.set(offset + i + 1, value);
+int64_t BoxCellSimplexCursorND::get_simplex_count(const int64_t p_dimension, const bool p_surface_only) {
+	if (p_dimension < 1) {
+		return 0;
 	}
+	// Each of the 2 * dimension facets has (dimension - 1)! simplexes.
+	return p_surface_only ? 2 * factorial(p_dimension) : factorial(p_dimension);
 }
 
-void BoxCellMeshND::_generate_cell_indices_lex(const int64_t p_dimension, PackedInt32Array &r_out) {
-	int64_t bits[30];
-	for (int64_t i = 0; i < p_dimension; ++i) {
-		bits[i] = i;
+// Sets the axis order to the permutation with the given rank in lexicographic order,
+// which is the order std::next_permutation visits them in.
+void BoxCellSimplexCursorND::_unrank_axis_order(int64_t p_rank) {
+	const int64_t axis_order_size = _get_axis_order_size();
+	const int64_t facet_axis = _surface_only ? _facet / 2 : -1;
+	int64_t available[30];
+	int64_t available_count = 0;
+	for (int64_t axis = 0; axis < _dimension; axis++) {
+		if (axis != facet_axis) {
+			available[available_count++] = axis;
+		}
+	}
+	for (int64_t i = 0; i < axis_order_size; i++) {
+		const int64_t remaining_count = factorial(axis_order_size - 1 - i);
+		const int64_t pick = p_rank / remaining_count;
+		p_rank %= remaining_count;
+		_axis_order[i] = available[pick];
+		for (int64_t j = pick; j < available_count - 1; j++) {
+			available[j] = available[j + 1];
+		}
+		available_count--;
 	}
+}
 
-	uint64_t index = 0;
-	do {
-		_write_gray_path(p_dimension, index++, bits, r_out);
-	} while (std::next_permutation(bits, bits + p_dimension));
+// The normal of a facet simplex has a positive determinant with its edges, which is the sign of the
+// permutation of its axis order followed by the facet axis, negated on the negative side of the box.
+bool BoxCellSimplexCursorND::_is_facet_simplex_flipped() const {
+	const int64_t facet_axis = _facet / 2;
+	const int64_t axis_order_size = _get_axis_order_size();
+	bool is_odd = false;
+	for (int64_t i = 0; i < axis_order_size; i++) {
+		for (int64_t j = i + 1; j < axis_order_size; j++) {
+			is_odd ^= _axis_order[i] > _axis_order[j];
+		}
+		is_odd ^= _axis_order[i] > facet_axis;
+	}
+	const bool is_positive_side = _facet & 1;
+	return is_odd == is_positive_side;
+}
+
+void BoxCellSimplexCursorND::start(const int64_t p_dimension, const bool p_surface_only) {
+	ERR_FAIL_COND_MSG(p_dimension > 30, "BoxCellSimplexCursorND: Too many dimensions for box cells.");
+	_dimension = p_dimension;
+	_surface_only = p_surface_only;
+	_facet = 0;
+	_is_done = p_dimension < 1;
+	_unrank_axis_order(0);
+}
+
+bool BoxCellSimplexCursorND::seek(const int64_t p_simplex_index) {
+	if (p_simplex_index < 0 || p_simplex_index >= get_simplex_count(_dimension, _surface_only)) {
+		_is_done = true;
+		return false;
+	}
+	const int64_t facet_simplex_count = factorial(_get_axis_order_size());
+	_facet = _surface_only ? p_simplex_index / facet_simplex_count : 0;
+	_unrank_axis_order(p_simplex_index % facet_simplex_count);
+	_is_done = false;
+	return true;
+}
+
+bool BoxCellSimplexCursorND::next(int32_t *r_indices) {
+	if (_is_done) {
+		return false;
+	}
+	const int64_t axis_order_size = _get_axis_order_size();
+	int32_t value = 0;
+	if (_surface_only && (_facet & 1)) {
+		value = int32_t(1) << (_facet / 2);
+	}
+	r_indices[0] = value;
+	for (int64_t i = 0; i < axis_order_size; i++) {
+		value ^= int32_t(1) << _axis_order[i];
+		r_indices[i + 1] = value;
+	}
+	if (_surface_only) {
+		if (_dimension > 1 && _is_facet_simplex_flipped()) {
+			SWAP(r_indices[_dimension - 2], r_indices[_dimension - 1]);
+		}
+		if (!std::next_permutation(_axis_order, _axis_order + axis_order_size)) {
+			_facet++;
+			_is_done = _facet == _dimension * 2;
+			if (!_is_done) {
+				_unrank_axis_order(0);
+			}
+		}
+	} else {
+		_is_done = !std::next_permutation(_axis_order, _axis_order + axis_order_size);
+	}
+	return true;
 }
 
 int BoxCellMeshND::get_simplex_cell_count() {
-	return _factorial(get_dimension());
+	return BoxCellSimplexCursorND::get_simplex_count(get_dimension(), _surface_only);
 }
 
 int BoxCellMeshND::get_indices_per_simplex_cell() {
-	return get_dimension() + 1;
+	return _surface_only ? get_dimension() : get_dimension() + 1;
 }
 
 PackedInt32Array BoxCellMeshND::get_simplex_cell_indices() {
@@ -87,14 +171,43 @@ PackedInt32Array BoxCellMeshND::get_simplex_cell_indices() {
 		if (dimension == 0) {
 			return _cell_indices_cache;
 		}
-		ERR_FAIL_COND_V_MSG(dimension > 10, _cell_indices_cache, "BoxCellMeshND: Too many dimensions for box cells.");
-		// Note: This algorithm completely fills the middle of the box.
+		ERR_FAIL_COND_V_MSG(!_can_store_simplex_cell_indices(), _cell_indices_cache, "BoxCellMeshND: Too many dimensions to store all box cells, use get_simplex_cell_indices_range instead.");
+		// Note: Unless only the surface is requested, this algorithm completely fills the middle of the box.
 		_cell_indices_cache.resize(get_simplex_cell_count() * get_indices_per_simplex_cell());
-		_generate_cell_indices_lex(dimension, _cell_indices_cache);
+		BoxCellSimplexCursorND cursor = get_simplex_cell_cursor();
+		int32_t *indices_ptrw = _cell_indices_cache.ptrw();
+		const int64_t indices_per_cell = cursor.get_indices_per_simplex();
+		while (cursor.next(indices_ptrw)) {
+			indices_ptrw += indices_per_cell;
+		}
 	}
 	return _cell_indices_cache;
 }
 
+PackedInt32Array BoxCellMeshND::get_simplex_cell_indices_range(const int64_t p_first_cell, const int64_t p_cell_count) const {
+	PackedInt32Array indices;
+	ERR_FAIL_COND_V_MSG(p_first_cell < 0 || p_cell_count < 0, indices, "BoxCellMeshND: Cell range must not be negative.");
+	BoxCellSimplexCursorND cursor = get_simplex_cell_cursor();
+	if (!cursor.seek(p_first_cell)) {
+		return indices;
+	}
+	const int64_t total_cell_count = BoxCellSimplexCursorND::get_simplex_count(_size.size(), _surface_only);
+	const int64_t cell_count = MIN(p_cell_count, total_cell_count - p_first_cell);
+	const int64_t indices_per_cell = cursor.get_indices_per_simplex();
+	indices.resize(cell_count * indices_per_cell);
+	int32_t *indices_ptrw = indices.ptrw();
+	for (int64_t i = 0; i < cell_count && cursor.next(indices_ptrw); i++) {
+		indices_ptrw += indices_per_cell;
+	}
+	return indices;
+}
+
+BoxCellSimplexCursorND BoxCellMeshND::get_simplex_cell_cursor() const {
+	BoxCellSimplexCursorND cursor;
+	cursor.start(_size.size(), _surface_only);
+	return cursor;
+}
+
 PackedInt32Array BoxCellMeshND::get_edge_indices() {
 	const uint64_t dimension = _size.size();
 	if (_edge_indices_cache.is_empty()) {
@@ -110,8 +223,24 @@ PackedInt32Array BoxCellMeshND::get_edge_indices() {
 					}
 				}
 			}
+		} else if (_can_store_simplex_cell_indices()) {
+			_edge_indices_cache = calculate_edge_indices_from_simplex_cell_indices(get_simplex_cell_indices(), get_indices_per_simplex_cell(), true);
 		} else {
-			_edge_indices_cache = calculate_edge_indices_from_simplex_cell_indices(get_simplex_cell_indices(), dimension + 1, true);
+			// Too many simplexes to store, but the simplexes are paths that only ever set more bits, so two vertices
+			// share an edge when the bits of one are a subset of the bits of the other. On the surface, they must
+			// also share a facet, so they can't be the opposite corners of the box.
+			const uint64_t vertex_count = uint64_t(1) << dimension;
+			for (uint64_t high = 1; high < vertex_count; high++) {
+				for (uint64_t low = (high - 1) & high;; low = (low - 1) & high) {
+					if (!_surface_only || low != 0 || high != vertex_count - 1) {
+						_edge_indices_cache.append(low);
+						_edge_indices_cache.append(high);
+					}
+					if (low == 0) {
+						break;
+					}
+				}
+			}
 		}
 	}
 	return _edge_indices_cache;
@@ -158,7 +287,7 @@ Ref<WireMeshND> BoxCellMeshND::to_wire_mesh() {
 
 void BoxCellMeshND::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_dimension", "dimension"), &BoxCellMeshND::set_dimension);
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "dimension", PROPERTY_HINT_RANGE, "0,10,1", PROPERTY_USAGE_EDITOR), "set_dimension", "get_dimension");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "dimension", PROPERTY_HINT_RANGE, "0,12,1", PROPERTY_USAGE_EDITOR), "set_dimension", "get_dimension");
 
 	ClassDB::bind_method(D_METHOD("get_half_extents"), &BoxCellMeshND::get_half_extents);
 	ClassDB::bind_method(D_METHOD("set_half_extents", "half_extents"), &BoxCellMeshND::set_half_extents);
@@ -172,6 +301,12 @@ void BoxCellMeshND::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_polytope_cells", "polytope_cells"), &BoxCellMeshND::set_polytope_cells);
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "polytope_cells"), "set_polytope_cells", "get_polytope_cells");
 
+	ClassDB::bind_method(D_METHOD("get_surface_only"), &BoxCellMeshND::get_surface_only);
+	ClassDB::bind_method(D_METHOD("set_surface_only", "surface_only"), &BoxCellMeshND::set_surface_only);
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "surface_only"), "set_surface_only", "get_surface_only");
+
+	ClassDB::bind_method(D_METHOD("get_simplex_cell_indices_range", "first_cell", "cell_count"), &BoxCellMeshND::get_simplex_cell_indices_range);
+
 	ClassDB::bind_static_method("BoxCellMeshND", D_METHOD("from_box_wire_mesh", "wire_mesh"), &BoxCellMeshND::from_box_wire_mesh);
 	ClassDB::bind_method(D_METHOD("to_box_wire_mesh"), &BoxCellMeshND::to_box_wire_mesh);
 }
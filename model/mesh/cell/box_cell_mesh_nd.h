@@ -5,6 +5,31 @@
 class BoxWireMeshND;
 class WireMeshND;
 
+// Yields the simplex cells of a box one at a time, in the same order as BoxCellMeshND::get_simplex_cell_indices,
+// without allocating the whole index buffer. Volume simplexes are the paths from the first vertex through every
+// order of the axes, with dimension + 1 indices each. Surface simplexes are the same paths on each facet of the
+// box, with dimension indices each, wound so that their normals point out of the box.
+class BoxCellSimplexCursorND {
+	int64_t _dimension = 0;
+	int64_t _facet = 0;
+	int64_t _axis_order[30];
+	bool _surface_only = false;
+	bool _is_done = true;
+
+	int64_t _get_axis_order_size() const { return _surface_only ? _dimension - 1 : _dimension; }
+	void _unrank_axis_order(int64_t p_rank);
+	bool _is_facet_simplex_flipped() const;
+
+public:
+	static int64_t factorial(const int64_t p_number);
+	static int64_t get_simplex_count(const int64_t p_dimension, const bool p_surface_only);
+	int64_t get_indices_per_simplex() const { return _surface_only ? _dimension : _dimension + 1; }
+
+	void start(const int64_t p_dimension, const bool p_surface_only);
+	bool seek(const int64_t p_simplex_index);
+	bool next(int32_t *r_indices);
+};
+
 class BoxCellMeshND : public CellMeshND {
 	GDCLASS(BoxCellMeshND, CellMeshND);
 
@@ -14,15 +39,14 @@ private:
 
 	VectorN _size;
 	bool _polytope_cells = false;
+	bool _surface_only = false;
 
 	void _clear_caches();
-	static int64_t _factorial(const int64_t p_dimension);
-	static void _write_gray_path(const int64_t p_dimension, const int64_t p_index, const int64_t *p_bit_order, PackedInt32Array &r_out);
-	static void _generate_cell_indices_lex(const int64_t p_dimension, PackedInt32Array &r_out);
 
 protected:
 	static void _bind_methods();
 	virtual bool validate_mesh_data() override { return true; }
+	virtual bool _can_store_simplex_cell_indices() override { return _size.size() <= 10; }
 
 public:
 	VectorN get_half_extents() const;
@@ -34,9 +58,14 @@ public:
 	bool get_polytope_cells() const { return _polytope_cells; }
 	void set_polytope_cells(const bool p_polytope_cells);
 
+	bool get_surface_only() const { return _surface_only; }
+	void set_surface_only(const bool p_surface_only);
+
 	virtual int get_simplex_cell_count() override;
 	virtual int get_indices_per_simplex_cell() override;
 	virtual PackedInt32Array get_simplex_cell_indices() override;
+	PackedInt32Array get_simplex_cell_indices_range(const int64_t p_first_cell, const int64_t p_cell_count) const;
+	BoxCellSimplexCursorND get_simplex_cell_cursor() const;
 	virtual PackedInt32Array get_edge_indices() override;
 	virtual Vector<VectorN> get_vertices() override;
 	virtual int get_dimension() override { return _size.size(); }
@@ -2,66 +2,47 @@
 
 #include "cell_mesh_nd.h"
 
-Color CellMaterialND::get_albedo_color_of_edge(const int64_t p_edge_index, const Ref<MeshND> &p_for_mesh) {
-	if (!(_albedo_source_flags & COLOR_SOURCE_FLAG_USES_COLOR_ARRAY)) {
-		// No need to allocate any memory for _edge_albedo_color_cache if the color array is not used.
-		if (_albedo_source_flags & COLOR_SOURCE_FLAG_SINGLE_COLOR) {
-			return _albedo_color;
-		}
-		return Color(1, 1, 1, 1);
-	}
-	if (p_edge_index < _edge_albedo_color_cache.size()) {
-		return _edge_albedo_color_cache[p_edge_index];
+void CellMaterialND::get_albedo_colors_of_edges(const Ref<MeshND> &p_for_mesh, PackedColorArray &r_edge_colors) const {
+	if (!(_albedo_source_flags & COLOR_SOURCE_FLAG_PER_CELL)) {
+		MaterialND::get_albedo_colors_of_edges(p_for_mesh, r_edge_colors);
+		return;
 	}
-	ERR_FAIL_COND_V_MSG(p_for_mesh.is_null(), _albedo_color, "CellMaterialND: Mesh is null.");
-	const PackedInt32Array edge_indices = p_for_mesh->get_edge_indices();
-	const int64_t edge_count = edge_indices.size() / 2;
-	ERR_FAIL_COND_V_MSG(p_edge_index >= edge_count, _albedo_color, "CellMaterialND: Edge index out of bounds for mesh.");
-	if (_albedo_source_flags & COLOR_SOURCE_FLAG_PER_CELL) {
-		Ref<CellMeshND> cell_mesh = p_for_mesh;
-		ERR_FAIL_COND_V_MSG(cell_mesh.is_null(), _albedo_color, "CellMaterialND: Mesh with per-cell colors is not a cell mesh.");
-		_edge_albedo_color_cache.resize(edge_count);
-		const PackedInt32Array cell_indices = cell_mesh->get_simplex_cell_indices();
-		const int64_t vertices_per_cell = cell_mesh->get_dimension();
-		for (int64_t i = 0; i < edge_count; i++) {
-			const int32_t first_vertex_index = edge_indices[i * 2];
-			const int32_t second_vertex_index = edge_indices[i * 2 + 1];
-			Color sum_color = Color(0, 0, 0, 0);
-			int color_amount = 0;
-			int64_t find_from = 0;
-			while (true) {
-				find_from = cell_indices.find(first_vertex_index, find_from);
-				if (find_from < 0) {
-					break;
-				}
-				// Truncated integer division to get the cell index.
-				const int64_t cell_index = find_from / vertices_per_cell;
-				ERR_FAIL_INDEX_V_MSG(cell_index, _albedo_color_array.size(), _albedo_color, "CellMaterialND: Cell index out of bounds for material's color array.");
-				find_from = cell_indices.find(second_vertex_index, cell_index * vertices_per_cell);
-				if (find_from < 0) {
-					break;
-				}
-				const int64_t next_cell_start = (cell_index + 1) * vertices_per_cell;
-				if (find_from < next_cell_start) {
-					// The second vertex is in the same cell as the first vertex, therefore this cell has this edge.
-					sum_color += _albedo_color_array[cell_index];
-					color_amount++;
-				}
-				find_from = next_cell_start;
+	ERR_FAIL_COND_MSG(p_for_mesh.is_null(), "CellMaterialND: Mesh is null.");
+	Ref<CellMeshND> cell_mesh = p_for_mesh;
+	ERR_FAIL_COND_MSG(cell_mesh.is_null(), "CellMaterialND: Mesh with per-cell colors is not a cell mesh.");
+	// Each edge gets the average color of the cells containing it, looked up from the mesh's edge to cell adjacency.
+	PackedInt32Array edge_cell_offsets;
+	PackedInt32Array edge_cell_indices;
+	cell_mesh->get_edge_cell_adjacency(edge_cell_offsets, edge_cell_indices);
+	const int64_t edge_count = edge_cell_offsets.size() - 1;
+	r_edge_colors.resize(MAX(edge_count, (int64_t)0));
+	const int32_t *offsets_ptr = edge_cell_offsets.ptr();
+	const int32_t *cells_ptr = edge_cell_indices.ptr();
+	const Color *color_array_ptr = _albedo_color_array.ptr();
+	const int64_t color_count = _albedo_color_array.size();
+	Color *edge_colors_ptrw = r_edge_colors.ptrw();
+	for (int64_t i = 0; i < edge_count; i++) {
+		Color sum_color = Color(0, 0, 0, 0);
+		const int color_amount = offsets_ptr[i + 1] - offsets_ptr[i];
+		for (int32_t adjacency_index = offsets_ptr[i]; adjacency_index < offsets_ptr[i + 1]; adjacency_index++) {
+			const int32_t cell_index = cells_ptr[adjacency_index];
+			if (unlikely(cell_index < 0 || cell_index >= color_count)) {
+				r_edge_colors.resize(i);
+				ERR_FAIL_MSG("CellMaterialND: Cell index out of bounds for material's color array.");
 			}
-			if (color_amount == 0) {
-				// No color found, use the single color as a fallback even if the single color flag is not set.
-				sum_color = _albedo_color;
-			} else {
-				sum_color /= color_amount;
-				if (_albedo_source_flags & COLOR_SOURCE_FLAG_SINGLE_COLOR) {
-					sum_color *= _albedo_color;
-				}
+			sum_color += color_array_ptr[cell_index];
+		}
+		if (color_amount == 0) {
+			// No color found, use the single color as a fallback even if the single color flag is not set.
+			sum_color = _albedo_color;
+		} else {
+			sum_color /= color_amount;
+			if (_albedo_source_flags & COLOR_SOURCE_FLAG_SINGLE_COLOR) {
+				sum_color *= _albedo_color;
 			}
-			_edge_albedo_color_cache.set(i, sum_color);
 		}
+		edge_colors_ptrw[i] = sum_color;
 	}
-	return MaterialND::get_albedo_color_of_edge(p_edge_index, p_for_mesh);
 }
 
 void CellMaterialND::_get_property_list(List<PropertyInfo> *p_list) const {
@@ -1,10 +1,20 @@
 #include "cell_mesh_nd.h"
 
+#include "../../../math/convex_hull_nd.h"
+#include "../../../math/index_tuple_set_nd.h"
 #include "../../../math/plane_nd.h"
 #include "../../../math/vector_nd.h"
 #include "array_cell_mesh_nd.h"
 #include "cell_material_nd.h"
 
+#if GDEXTENSION
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#elif GODOT_MODULE
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#endif
+
 int64_t CellMeshND::_binomial_coefficient(const int64_t n, const int64_t k) {
 	if (k < 0 || k > n) {
 		return 0;
@@ -45,8 +55,8 @@ Vector<PackedInt32Array> CellMeshND::_generate_combinations(const PackedInt32Arr
 	return result;
 }
 
-// Find unique opposing faces of the cell that are not coplanar with the pivot.
-Vector<PackedInt32Array> CellMeshND::_determine_opposing_faces(const Vector<VectorN> &p_vertices, const PackedInt32Array &p_poly_cell_indices_without_pivot, const int p_dimension, const int p_pivot_index, const Vector<VectorN> &p_poly_cell_normals, Vector<VectorN> &r_out_normals) {
+// Find unique opposing faces of the cell that are not coplanar with the pivot, by testing every combination of vertices.
+Vector<PackedInt32Array> CellMeshND::_determine_opposing_faces_by_combinations(const Vector<VectorN> &p_vertices, const PackedInt32Array &p_poly_cell_indices_without_pivot, const int p_dimension, const int p_pivot_index, const Vector<VectorN> &p_poly_cell_normals, Vector<VectorN> &r_out_normals) {
 	Vector<PackedInt32Array> combinations = _generate_combinations(p_poly_cell_indices_without_pivot, p_dimension);
 	const VectorN pivot_vertex = p_vertices[p_pivot_index];
 	Vector<PackedInt32Array> opposing_faces;
@@ -102,23 +112,201 @@ Vector<PackedInt32Array> CellMeshND::_determine_opposing_faces(const Vector<Vect
 	return opposing_faces;
 }
 
+// Projects the vertices of a cell onto an orthonormal basis of their affine span, so the hull can be built
+// in the cell's own dimension. The pivot is placed after the other vertices. Returns false if the vertices
+// span fewer than p_dimension dimensions.
+static bool _calculate_cell_coordinates(const Vector<VectorN> &p_vertices, const PackedInt32Array &p_cell_indices_without_pivot, const int p_pivot_index, const int p_dimension, LocalVector<double> &r_coordinates, LocalVector<VectorN> &r_axes) {
+	LocalVector<const VectorN *> points;
+	for (const int32_t index : p_cell_indices_without_pivot) {
+		points.push_back(&p_vertices[index]);
+	}
+	points.push_back(&p_vertices[p_pivot_index]);
+	int64_t ambient_dimension = 0;
+	for (const VectorN *point : points) {
+		ambient_dimension = MAX(ambient_dimension, point->size());
+	}
+	// Greedily pick the axis towards the point farthest from the span of the axes picked so far.
+	const VectorN origin = *points[0];
+	LocalVector<VectorN> residuals;
+	for (const VectorN *point : points) {
+		residuals.push_back(VectorND::with_dimension(VectorND::subtract(*point, origin), ambient_dimension));
+	}
+	for (int axis_index = 0; axis_index < p_dimension; axis_index++) {
+		int64_t best_point = -1;
+		double best_length = CMP_EPSILON;
+		for (uint32_t i = 0; i < residuals.size(); i++) {
+			const double length = VectorND::length(residuals[i]);
+			if (length > best_length) {
+				best_length = length;
+				best_point = i;
+			}
+		}
+		if (best_point < 0) {
+			return false;
+		}
+		const VectorN axis = VectorND::divide_scalar(residuals[best_point], best_length);
+		for (VectorN &residual : residuals) {
+			residual = VectorND::subtract(residual, VectorND::multiply_scalar(axis, VectorND::dot(residual, axis)));
+		}
+		r_axes.push_back(axis);
+	}
+	r_coordinates.resize(points.size() * p_dimension);
+	for (uint32_t i = 0; i < points.size(); i++) {
+		const VectorN offset = VectorND::subtract(*points[i], origin);
+		for (int axis_index = 0; axis_index < p_dimension; axis_index++) {
+			r_coordinates[i * p_dimension + axis_index] = VectorND::dot(offset, r_axes[axis_index]);
+		}
+	}
+	return true;
+}
+
+// Faces are returned in the order the combinatorial search used to find them, which is by the
+// lexicographically first combination of vertices spanning the face. Greedily picking affinely
+// independent vertices in order gives exactly that combination.
+struct OpposingFaceOrderND {
+	const int32_t *first_combination = nullptr;
+	int64_t dimension = 0;
+	int64_t face = 0;
+
+	bool operator<(const OpposingFaceOrderND &p_other) const {
+		for (int64_t i = 0; i < dimension; i++) {
+			if (first_combination[i] != p_other.first_combination[i]) {
+				return first_combination[i] < p_other.first_combination[i];
+			}
+		}
+		return face < p_other.face;
+	}
+};
+
+static void _find_first_spanning_combination(const double *p_coordinates, const int p_dimension, const int32_t *p_face_points, const int64_t p_face_point_count, int32_t *r_combination) {
+	LocalVector<double> basis;
+	LocalVector<double> residual;
+	residual.resize(p_dimension);
+	const double *first = p_coordinates + p_face_points[0] * p_dimension;
+	r_combination[0] = p_face_points[0];
+	int64_t picked_count = 1;
+	for (int64_t i = 1; i < p_face_point_count && picked_count < p_dimension; i++) {
+		const double *point = p_coordinates + p_face_points[i] * p_dimension;
+		for (int axis = 0; axis < p_dimension; axis++) {
+			residual[axis] = point[axis] - first[axis];
+		}
+		for (int64_t b = 0; b < picked_count - 1; b++) {
+			const double *basis_vector = basis.ptr() + b * p_dimension;
+			double dot = 0.0;
+			for (int axis = 0; axis < p_dimension; axis++) {
+				dot += residual[axis] * basis_vector[axis];
+			}
+			for (int axis = 0; axis < p_dimension; axis++) {
+				residual[axis] -= dot * basis_vector[axis];
+			}
+		}
+		double length_squared = 0.0;
+		for (int axis = 0; axis < p_dimension; axis++) {
+			length_squared += residual[axis] * residual[axis];
+		}
+		const double length = Math::sqrt(length_squared);
+		if (length <= CMP_EPSILON) {
+			continue;
+		}
+		for (int axis = 0; axis < p_dimension; axis++) {
+			basis.push_back(residual[axis] / length);
+		}
+		r_combination[picked_count++] = p_face_points[i];
+	}
+	for (int64_t i = picked_count; i < p_dimension; i++) {
+		r_combination[i] = INT32_MAX;
+	}
+}
+
+// Find unique opposing faces of the cell that are not coplanar with the pivot, from the facets of the convex hull of the cell.
+Vector<PackedInt32Array> CellMeshND::_determine_opposing_faces(const Vector<VectorN> &p_vertices, const PackedInt32Array &p_poly_cell_indices_without_pivot, const int p_dimension, const int p_pivot_index, const Vector<VectorN> &p_poly_cell_normals, Vector<VectorN> &r_out_normals) {
+	Vector<PackedInt32Array> opposing_faces;
+	if (p_dimension < 1) {
+		return opposing_faces;
+	}
+	LocalVector<double> coordinates;
+	LocalVector<VectorN> axes;
+	ConvexHullND hull;
+	if (!_calculate_cell_coordinates(p_vertices, p_poly_cell_indices_without_pivot, p_pivot_index, p_dimension, coordinates, axes) || !hull.build(coordinates.ptr(), p_poly_cell_indices_without_pivot.size() + 1, p_dimension)) {
+		// Nearly degenerate cells can't be handled by the hull, but testing every combination still works.
+		return _determine_opposing_faces_by_combinations(p_vertices, p_poly_cell_indices_without_pivot, p_dimension, p_pivot_index, p_poly_cell_normals, r_out_normals);
+	}
+	// Each face of the cell is the set of vertices on the plane of any hull facet on it.
+	const int32_t pivot_point = p_poly_cell_indices_without_pivot.size();
+	IndexTupleSetND faces;
+	LocalVector<int64_t> face_facets;
+	LocalVector<int32_t> face_points;
+	for (int64_t facet = 0; facet < hull.get_facet_count(); facet++) {
+		if (!hull.is_facet_alive(facet) || Math::is_zero_approx(hull.distance_to(facet, pivot_point))) {
+			continue;
+		}
+		face_points.clear();
+		for (int32_t point = 0; point < pivot_point; point++) {
+			if (Math::is_zero_approx(hull.distance_to(facet, point))) {
+				face_points.push_back(point);
+			}
+		}
+		bool inserted = false;
+		faces.find_or_insert(face_points.ptr(), face_points.size(), inserted);
+		if (inserted) {
+			face_facets.push_back(facet);
+		}
+	}
+	LocalVector<int32_t> first_combinations;
+	first_combinations.resize(faces.size() * p_dimension);
+	LocalVector<OpposingFaceOrderND> face_order;
+	for (int64_t face = 0; face < faces.size(); face++) {
+		_find_first_spanning_combination(coordinates.ptr(), p_dimension, faces.get_tuple(face), faces.get_tuple_size(face), first_combinations.ptr() + face * p_dimension);
+	}
+	for (int64_t face = 0; face < faces.size(); face++) {
+		OpposingFaceOrderND order;
+		order.first_combination = first_combinations.ptr() + face * p_dimension;
+		order.dimension = p_dimension;
+		order.face = face;
+		face_order.push_back(order);
+	}
+	face_order.sort();
+	for (const OpposingFaceOrderND &order : face_order) {
+		const int32_t *points = faces.get_tuple(order.face);
+		PackedInt32Array face;
+		face.resize(faces.get_tuple_size(order.face));
+		for (int64_t i = 0; i < face.size(); i++) {
+			face.set(i, p_poly_cell_indices_without_pivot[points[i]]);
+		}
+		face.sort();
+		opposing_faces.append(face);
+		const double *facet_normal = hull.get_facet_normal(face_facets[order.face]);
+		VectorN normal;
+		for (int axis_index = 0; axis_index < p_dimension; axis_index++) {
+			normal = VectorND::add(normal, VectorND::multiply_scalar(axes[axis_index], facet_normal[axis_index]));
+		}
+		r_out_normals.append(normal);
+	}
+	return opposing_faces;
+}
+
 void CellMeshND::cell_mesh_clear_cache() {
 	_cell_positions_cache.clear();
 	_edge_positions_cache.clear();
 	_edge_indices_cache.clear();
+	_edge_cell_offsets_cache.clear();
+	_edge_cell_indices_cache.clear();
 	mark_rect_bounds_dirty();
 }
 
 void CellMeshND::validate_material_for_mesh(const Ref<MaterialND> &p_material) {
-	const int dimension = get_dimension();
 	const MaterialND::ColorSourceFlagsND albedo_source = p_material->get_albedo_source_flags();
 	if (albedo_source & MaterialND::COLOR_SOURCE_FLAG_PER_CELL) {
-		const PackedInt32Array cell_indices = get_simplex_cell_indices();
-		PackedColorArray color_array = p_material->get_albedo_color_array();
-		const int64_t vertices_per_cell = dimension + 1;
-		const int64_t cell_count = cell_indices.size() / vertices_per_cell;
-		if (color_array.size() < cell_count) {
-			p_material->resize_albedo_color_array(cell_count);
+		if (!_can_store_simplex_cell_indices()) {
+			ERR_PRINT_ONCE("CellMeshND: Per-cell colors are not supported on meshes with too many cells to store, edges will use the material's albedo color instead.");
+		} else {
+			const PackedInt32Array cell_indices = get_simplex_cell_indices();
+			PackedColorArray color_array = p_material->get_albedo_color_array();
+			const int64_t vertices_per_cell = MAX(get_indices_per_simplex_cell(), 1);
+			const int64_t cell_count = cell_indices.size() / vertices_per_cell;
+			if (color_array.size() < cell_count) {
+				p_material->resize_albedo_color_array(cell_count);
+			}
 		}
 	}
 	MeshND::validate_material_for_mesh(p_material);
@@ -126,8 +314,13 @@ void CellMeshND::validate_material_for_mesh(const Ref<MaterialND> &p_material) {
 
 Ref<ArrayCellMeshND> CellMeshND::to_array_cell_mesh() {
 	Ref<ArrayCellMeshND> array_mesh;
+	ERR_FAIL_COND_V_MSG(!_can_store_simplex_cell_indices(), array_mesh, "CellMeshND: Cannot convert a mesh with too many cells to store to an array cell mesh.");
 	array_mesh.instantiate();
-	array_mesh->set_vertices(get_vertices());
+	PackedFloat64Array vertices_flat;
+	int64_t vertex_count = 0;
+	int stride = 0;
+	get_vertices_flat_checked(vertices_flat, vertex_count, stride);
+	array_mesh->set_vertices_flat(vertices_flat, vertex_count, stride);
 	array_mesh->set_simplex_cell_indices(get_simplex_cell_indices());
 	array_mesh->set_cell_boundary_normals(get_simplex_cell_boundary_normals());
 	array_mesh->set_simplex_cell_vertex_normals(get_simplex_cell_vertex_normals());
@@ -239,7 +432,8 @@ TypedArray<VectorN> CellMeshND::get_simplex_cell_positions_bind() {
 // 2. Find unique opposing faces of the cell that are not coplanar with the pivot.
 // 3. For each face, recursively call this function with the face as the new cell.
 // 4. Each of the returned simplexes will have the pivot index prepended to it.
-// This function has atrocious time complexity, so avoid using it on large cells or at runtime.
+// The faces are found from the convex hull of the cell, so cells with many vertices are fine,
+// but the result grows quickly with the dimension, so still avoid using it at runtime.
 Vector<PackedInt32Array> CellMeshND::decompose_polytope_cell_into_simplexes(const Vector<VectorN> &p_vertices, const PackedInt32Array &p_poly_cell_indices, const int p_dimension, const int p_last_pivot, const Vector<VectorN> &p_poly_cell_normals) {
 	Vector<PackedInt32Array> simplexes;
 	if (p_poly_cell_indices.size() < 2) {
@@ -301,6 +495,109 @@ PackedInt32Array CellMeshND::calculate_edge_indices_from_simplex_cell_indices(co
 	return edge_indices;
 }
 
+static _FORCE_INLINE_ uint64_t _make_edge_key(const int32_t p_a, const int32_t p_b) {
+	// Edges are undirected, so order the two vertex indices to get one key for both directions.
+	const uint32_t low = (uint32_t)MIN(p_a, p_b);
+	const uint32_t high = (uint32_t)MAX(p_a, p_b);
+	return ((uint64_t)high << 32) | (uint64_t)low;
+}
+
+void CellMeshND::_build_edge_cell_adjacency() {
+	const PackedInt32Array edge_indices = get_edge_indices();
+	const int64_t edge_count = edge_indices.size() / 2;
+	_edge_cell_offsets_cache.resize(edge_count + 1);
+	_edge_cell_offsets_cache.fill(0);
+	_edge_cell_indices_cache.clear();
+	if (!_can_store_simplex_cell_indices()) {
+		return; // Every edge has no cells.
+	}
+	const PackedInt32Array cell_indices = get_simplex_cell_indices();
+	const int64_t indices_per_cell = get_indices_per_simplex_cell();
+	ERR_FAIL_COND_MSG(indices_per_cell < 1 || cell_indices.size() % indices_per_cell != 0, "CellMeshND: Simplex cell indices size must be a multiple of the indices per simplex cell.");
+	const int64_t cell_count = cell_indices.size() / indices_per_cell;
+	const int64_t edges_per_cell = indices_per_cell * (indices_per_cell - 1) / 2;
+	const int32_t *edge_indices_ptr = edge_indices.ptr();
+	// Custom edge indices may list the same edge more than once, so the lookup finds the first copy,
+	// and each copy links to the next copy, so that every copy gets the cells of the edge.
+	HashMap<uint64_t, int32_t> edge_lookup;
+	edge_lookup.reserve(edge_count);
+	PackedInt32Array next_same_edges;
+	next_same_edges.resize(edge_count);
+	next_same_edges.fill(-1);
+	int32_t *next_same_edges_ptrw = next_same_edges.ptrw();
+	for (int64_t i = 0; i < edge_count; i++) {
+		const uint64_t edge_key = _make_edge_key(edge_indices_ptr[i * 2], edge_indices_ptr[i * 2 + 1]);
+		const int32_t *first_edge = edge_lookup.getptr(edge_key);
+		if (first_edge) {
+			next_same_edges_ptrw[i] = next_same_edges_ptrw[*first_edge];
+			next_same_edges_ptrw[*first_edge] = i;
+		} else {
+			edge_lookup.insert(edge_key, i);
+		}
+	}
+	// First pass: find the edge of each vertex pair of each cell, and count the cells of each edge.
+	// Counts are stored one slot ahead, so that the prefix sum below turns them into start offsets.
+	// Not every vertex pair is an edge, for example box meshes only list the edges of the box.
+	PackedInt32Array cell_edges;
+	cell_edges.resize(cell_count * edges_per_cell);
+	int32_t *cell_edges_ptrw = cell_edges.ptrw();
+	int32_t *offsets_ptrw = _edge_cell_offsets_cache.ptrw();
+	const int32_t *cell_indices_ptr = cell_indices.ptr();
+	for (int64_t cell_index = 0; cell_index < cell_count; cell_index++) {
+		const int32_t *cell = cell_indices_ptr + cell_index * indices_per_cell;
+		int32_t *cell_edges_of_cell = cell_edges_ptrw + cell_index * edges_per_cell;
+		int64_t pair_index = 0;
+		for (int64_t i = 0; i < indices_per_cell; i++) {
+			for (int64_t j = i + 1; j < indices_per_cell; j++) {
+				const int32_t *first_edge = edge_lookup.getptr(_make_edge_key(cell[i], cell[j]));
+				cell_edges_of_cell[pair_index++] = first_edge ? *first_edge : -1;
+				for (int32_t edge = first_edge ? *first_edge : -1; edge >= 0; edge = next_same_edges_ptrw[edge]) {
+					offsets_ptrw[edge + 1]++;
+				}
+			}
+		}
+	}
+	for (int64_t i = 0; i < edge_count; i++) {
+		offsets_ptrw[i + 1] += offsets_ptrw[i];
+	}
+	// Second pass: write the cells of each edge. Cells are visited in order, so each edge lists its cells in ascending order.
+	_edge_cell_indices_cache.resize(offsets_ptrw[edge_count]);
+	int32_t *adjacent_cells_ptrw = _edge_cell_indices_cache.ptrw();
+	PackedInt32Array write_positions = _edge_cell_offsets_cache;
+	int32_t *write_positions_ptrw = write_positions.ptrw();
+	for (int64_t cell_index = 0; cell_index < cell_count; cell_index++) {
+		const int32_t *cell_edges_of_cell = cell_edges_ptrw + cell_index * edges_per_cell;
+		for (int64_t pair_index = 0; pair_index < edges_per_cell; pair_index++) {
+			for (int32_t edge = cell_edges_of_cell[pair_index]; edge >= 0; edge = next_same_edges_ptrw[edge]) {
+				adjacent_cells_ptrw[write_positions_ptrw[edge]++] = cell_index;
+			}
+		}
+	}
+}
+
+void CellMeshND::get_edge_cell_adjacency(PackedInt32Array &r_edge_cell_offsets, PackedInt32Array &r_edge_cell_indices) {
+	if (_edge_cell_offsets_cache.is_empty()) {
+		_build_edge_cell_adjacency();
+	}
+	r_edge_cell_offsets = _edge_cell_offsets_cache;
+	r_edge_cell_indices = _edge_cell_indices_cache;
+}
+
+PackedInt32Array CellMeshND::get_cells_of_edge(const int64_t p_edge_index) {
+	PackedInt32Array edge_cells;
+	if (_edge_cell_offsets_cache.is_empty()) {
+		_build_edge_cell_adjacency();
+	}
+	ERR_FAIL_INDEX_V_MSG(p_edge_index, _edge_cell_offsets_cache.size() - 1, edge_cells, "CellMeshND: Edge index out of bounds.");
+	const int32_t start = _edge_cell_offsets_cache[p_edge_index];
+	const int32_t end = _edge_cell_offsets_cache[p_edge_index + 1];
+	edge_cells.resize(end - start);
+	for (int32_t i = start; i < end; i++) {
+		edge_cells.set(i - start, _edge_cell_indices_cache[i]);
+	}
+	return edge_cells;
+}
+
 PackedInt32Array CellMeshND::get_edge_indices() {
 	const int dimension = get_dimension();
 	if (_edge_indices_cache.is_empty()) {
@@ -309,6 +606,14 @@ PackedInt32Array CellMeshND::get_edge_indices() {
 	return _edge_indices_cache;
 }
 
+void CellMeshND::set_edge_indices_cache(const PackedInt32Array &p_edge_indices) {
+	// Only for edges known to match the simplex cell indices, such as those saved by BinaryMeshND.
+	_edge_indices_cache = p_edge_indices;
+	_edge_positions_cache.clear();
+	_edge_cell_offsets_cache.clear();
+	_edge_cell_indices_cache.clear();
+}
+
 Vector<VectorN> CellMeshND::get_edge_positions() {
 	if (_edge_positions_cache.is_empty()) {
 		const PackedInt32Array edge_indices = get_edge_indices();
@@ -326,6 +631,7 @@ void CellMeshND::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("cell_mesh_clear_cache"), &CellMeshND::cell_mesh_clear_cache);
 	ClassDB::bind_method(D_METHOD("get_simplex_cell_count"), &CellMeshND::get_simplex_cell_count);
 	ClassDB::bind_method(D_METHOD("get_indices_per_simplex_cell"), &CellMeshND::get_indices_per_simplex_cell);
+	ClassDB::bind_method(D_METHOD("get_cells_of_edge", "edge_index"), &CellMeshND::get_cells_of_edge);
 	ClassDB::bind_method(D_METHOD("to_array_cell_mesh"), &CellMeshND::to_array_cell_mesh);
 
 	ClassDB::bind_static_method("CellMeshND", D_METHOD("calculate_edge_indices_from_simplex_cell_indices", "simplex_cell_indices", "dimension", "deduplicate"), &CellMeshND::calculate_edge_indices_from_simplex_cell_indices);
@@ -8,14 +8,24 @@ class CellMeshND : public MeshND {
 	GDCLASS(CellMeshND, MeshND);
 
 	Vector<VectorN> _cell_positions_cache;
+	// Edge to cell adjacency in compressed sparse row form. The cells containing edge i are
+	// the values of _edge_cell_indices_cache from _edge_cell_offsets_cache[i] to _edge_cell_offsets_cache[i + 1].
+	PackedInt32Array _edge_cell_offsets_cache;
+	PackedInt32Array _edge_cell_indices_cache;
+
+	void _build_edge_cell_adjacency();
 
 	static int64_t _binomial_coefficient(const int64_t n, const int64_t k);
 	static void _generate_combinations_recursive(const PackedInt32Array &p_items, const int64_t p_count, const int64_t p_choose, const int64_t p_start, const int64_t p_depth, int &r_result_index, PackedInt32Array &r_current, Vector<PackedInt32Array> &r_result);
 	static Vector<PackedInt32Array> _generate_combinations(const PackedInt32Array &p_items, int64_t p_choose);
+	static Vector<PackedInt32Array> _determine_opposing_faces_by_combinations(const Vector<VectorN> &p_vertices, const PackedInt32Array &p_cell_indices_without_pivot, const int p_dimension, const int p_pivot_index, const Vector<VectorN> &p_cell_normals, Vector<VectorN> &r_out_normals);
 	static Vector<PackedInt32Array> _determine_opposing_faces(const Vector<VectorN> &p_vertices, const PackedInt32Array &p_cell_indices_without_pivot, const int p_dimension, const int p_pivot_index, const Vector<VectorN> &p_cell_normals, Vector<VectorN> &r_out_normals);
 
 protected:
 	static void _bind_methods();
+	// Meshes with too many cells to store all of their indices return false, such as boxes with many dimensions.
+	// Per-cell data like the edge to cell adjacency is then unavailable, instead of failing on every use.
+	virtual bool _can_store_simplex_cell_indices() { return true; }
 	PackedInt32Array _edge_indices_cache;
 	Vector<VectorN> _edge_positions_cache;
 
@@ -36,8 +46,12 @@ public:
 
 	static Vector<PackedInt32Array> decompose_polytope_cell_into_simplexes(const Vector<VectorN> &p_vertices, const PackedInt32Array &p_poly_cell_indices, const int p_dimension, const int p_last_pivot, const Vector<VectorN> &p_poly_cell_normals);
 
+	void get_edge_cell_adjacency(PackedInt32Array &r_edge_cell_offsets, PackedInt32Array &r_edge_cell_indices); // Internal use only, do not expose.
+	PackedInt32Array get_cells_of_edge(const int64_t p_edge_index);
+
 	static PackedInt32Array calculate_edge_indices_from_simplex_cell_indices(const PackedInt32Array &p_simplex_cell_indices, const int p_dimension, const bool p_deduplicate = true);
 	virtual PackedInt32Array get_edge_indices() override;
+	void set_edge_indices_cache(const PackedInt32Array &p_edge_indices); // Internal use only, do not expose.
 	virtual Vector<VectorN> get_edge_positions() override;
 
 	GDVIRTUAL0R(PackedInt32Array, _get_simplex_cell_indices);
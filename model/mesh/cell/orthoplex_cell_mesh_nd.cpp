@@ -7,6 +7,7 @@ void OrthoplexCellMeshND::_clear_caches() {
 	_cell_indices_cache.clear();
 	_vertices_cache.clear();
 	cell_mesh_clear_cache();
+	reset_mesh_data_validation();
 }
 
 VectorN OrthoplexCellMeshND::get_half_extents() const {
@@ -2,53 +2,64 @@
 
 #include "mesh_nd.h"
 
-Color MaterialND::get_albedo_color_of_edge(const int64_t p_edge_index, const Ref<MeshND> &p_for_mesh) {
-	if (!(_albedo_source_flags & COLOR_SOURCE_FLAG_USES_COLOR_ARRAY)) {
-		// No need to allocate any memory for _edge_albedo_color_cache if the color array is not used.
-		if (likely(_albedo_source_flags & COLOR_SOURCE_FLAG_SINGLE_COLOR)) {
-			return _albedo_color;
-		}
-		return Color(1, 1, 1, 1);
-	}
-	if (p_edge_index < _edge_albedo_color_cache.size()) {
-		return _edge_albedo_color_cache[p_edge_index];
-	}
-	ERR_FAIL_COND_V_MSG(p_for_mesh.is_null(), _albedo_color, "MaterialND: Mesh is null.");
+void MaterialND::get_albedo_colors_of_edges(const Ref<MeshND> &p_for_mesh, PackedColorArray &r_edge_colors) const {
+	ERR_FAIL_COND_MSG(p_for_mesh.is_null(), "MaterialND: Mesh is null.");
 	const PackedInt32Array edge_indices = p_for_mesh->get_edge_indices();
 	const int64_t edge_count = edge_indices.size() / 2;
-	ERR_FAIL_COND_V_MSG(p_edge_index >= edge_count, _albedo_color, "MaterialND: Edge index out of bounds for mesh.");
+	r_edge_colors.resize(edge_count);
+	Color *edge_colors_ptrw = r_edge_colors.ptrw();
+	const Color single_color = (_albedo_source_flags & COLOR_SOURCE_FLAG_SINGLE_COLOR) ? _albedo_color : Color(1, 1, 1, 1);
 	if (_albedo_source_flags & COLOR_SOURCE_FLAG_PER_EDGE) {
-		ERR_FAIL_COND_V_MSG(edge_count > _albedo_color_array.size(), _albedo_color, "MaterialND: Mesh has more edges than the material's color array.");
-		if (_albedo_source_flags & COLOR_SOURCE_FLAG_SINGLE_COLOR) {
-			_edge_albedo_color_cache.resize(edge_count);
-			for (int64_t i = 0; i < edge_count; i++) {
-				_edge_albedo_color_cache.set(i, _albedo_color_array[i] * _albedo_color);
-			}
-		} else {
-			_edge_albedo_color_cache = _albedo_color_array.duplicate();
+		if (unlikely(edge_count > _albedo_color_array.size())) {
+			r_edge_colors.clear();
+			ERR_FAIL_MSG("MaterialND: Mesh has more edges than the material's color array.");
+		}
+		const Color *color_array_ptr = _albedo_color_array.ptr();
+		for (int64_t i = 0; i < edge_count; i++) {
+			edge_colors_ptrw[i] = color_array_ptr[i] * single_color;
 		}
 	} else if (_albedo_source_flags & COLOR_SOURCE_FLAG_PER_VERT) {
-		_edge_albedo_color_cache.resize(edge_count);
+		const int32_t *edge_indices_ptr = edge_indices.ptr();
+		const Color *color_array_ptr = _albedo_color_array.ptr();
+		const int64_t color_count = _albedo_color_array.size();
 		for (int64_t i = 0; i < edge_count; i++) {
-			const int32_t first_vertex = edge_indices[i * 2];
-			const int32_t second_vertex = edge_indices[i * 2 + 1];
-			ERR_FAIL_INDEX_V_MSG(first_vertex, _albedo_color_array.size(), _albedo_color, "MaterialND: Cannot get vertex color of mesh because the first vertex index is out of bounds of the material's color array.");
-			ERR_FAIL_INDEX_V_MSG(second_vertex, _albedo_color_array.size(), _albedo_color, "MaterialND: Cannot get vertex color of mesh because the second vertex index is out of bounds of the material's color array.");
-			const Color per_edge_color = (_albedo_color_array[first_vertex] + _albedo_color_array[second_vertex]) * 0.5f;
-			if (_albedo_source_flags & COLOR_SOURCE_FLAG_SINGLE_COLOR) {
-				_edge_albedo_color_cache.set(i, per_edge_color * _albedo_color);
-			} else {
-				_edge_albedo_color_cache.set(i, per_edge_color);
+			const int32_t first_vertex = edge_indices_ptr[i * 2];
+			const int32_t second_vertex = edge_indices_ptr[i * 2 + 1];
+			if (unlikely(first_vertex < 0 || first_vertex >= color_count || second_vertex < 0 || second_vertex >= color_count)) {
+				r_edge_colors.resize(i);
+				ERR_FAIL_MSG("MaterialND: Cannot get vertex color of mesh because a vertex index is out of bounds of the material's color array.");
 			}
+			edge_colors_ptrw[i] = (color_array_ptr[first_vertex] + color_array_ptr[second_vertex]) * 0.5f * single_color;
 		}
-	} else if (_albedo_source_flags & COLOR_SOURCE_FLAG_SINGLE_COLOR) {
-		_edge_albedo_color_cache.resize(edge_count);
-		_edge_albedo_color_cache.fill(_albedo_color);
 	} else {
-		_edge_albedo_color_cache.resize(edge_count);
-		_edge_albedo_color_cache.fill(Color(1, 1, 1, 1));
+		r_edge_colors.fill(single_color);
+	}
+}
+
+Color MaterialND::get_albedo_color_of_edge(const int64_t p_edge_index, const Ref<MeshND> &p_for_mesh) {
+	if (!(_albedo_source_flags & COLOR_SOURCE_FLAG_USES_COLOR_ARRAY)) {
+		// No need to allocate any memory for _edge_albedo_color_cache if the color array is not used.
+		if (likely(_albedo_source_flags & COLOR_SOURCE_FLAG_SINGLE_COLOR)) {
+			return _albedo_color;
+		}
+		return Color(1, 1, 1, 1);
+	}
+	ERR_FAIL_COND_V_MSG(p_for_mesh.is_null(), _albedo_color, "MaterialND: Mesh is null.");
+	const ObjectID mesh_id = ObjectID(p_for_mesh->get_instance_id());
+	if (_edge_albedo_color_cache_mesh_id != mesh_id || _edge_albedo_color_cache_mesh_version != p_for_mesh->get_version() || _edge_albedo_color_cache_version != _version) {
+		get_albedo_colors_of_edges(p_for_mesh, _edge_albedo_color_cache);
+		_edge_albedo_color_cache_mesh_id = mesh_id;
+		_edge_albedo_color_cache_mesh_version = p_for_mesh->get_version();
+		_edge_albedo_color_cache_version = _version;
 	}
-	return _albedo_color;
+	ERR_FAIL_INDEX_V_MSG(p_edge_index, _edge_albedo_color_cache.size(), _albedo_color, "MaterialND: Edge index out of bounds for mesh.");
+	return _edge_albedo_color_cache[p_edge_index];
+}
+
+void MaterialND::_mark_changed() {
+	_version++;
+	_edge_albedo_color_cache.clear();
+	emit_changed();
 }
 
 bool MaterialND::is_default_material() const {
@@ -57,29 +68,33 @@ bool MaterialND::is_default_material() const {
 
 void MaterialND::set_albedo_color(const Color &p_albedo_color) {
 	_albedo_color = p_albedo_color;
-	_edge_albedo_color_cache.clear();
+	_mark_changed();
 }
 
 void MaterialND::set_albedo_source_flags(const ColorSourceFlagsND p_albedo_source_flags) {
 	_albedo_source_flags = p_albedo_source_flags;
-	_edge_albedo_color_cache.clear();
+	_mark_changed();
 }
 
 void MaterialND::set_albedo_color_array(const PackedColorArray &p_albedo_color_array) {
 	_albedo_color_array = p_albedo_color_array;
-	_edge_albedo_color_cache.clear();
+	_mark_changed();
 }
 
 void MaterialND::append_albedo_color(const Color &p_albedo_color) {
 	_albedo_color_array.push_back(p_albedo_color);
+	_mark_changed();
 }
 
 void MaterialND::resize_albedo_color_array(const int64_t p_size, const Color &p_fill_color) {
+	// This does not emit changed, since meshes call it when validating a material right before rendering.
 	const int64_t existing_size = _albedo_color_array.size();
 	_albedo_color_array.resize(p_size);
 	for (int64_t i = existing_size; i < p_size; i++) {
 		_albedo_color_array.set(i, p_fill_color);
 	}
+	_version++;
+	_edge_albedo_color_cache.clear();
 }
 
 void MaterialND::_bind_methods() {
@@ -33,13 +33,25 @@ public:
 protected:
 	static void _bind_methods();
 
+	// Only valid for the mesh it was computed for, so sharing a material between meshes recomputes it when switching.
 	PackedColorArray _edge_albedo_color_cache;
+	ObjectID _edge_albedo_color_cache_mesh_id;
+	uint64_t _edge_albedo_color_cache_mesh_version = 0;
+	uint64_t _edge_albedo_color_cache_version = 0;
+	// Incremented on every modification, so renderers can cache per-mesh data derived from this material.
+	uint64_t _version = 1;
 	PackedColorArray _albedo_color_array;
 	Color _albedo_color = Color(1, 1, 1, 1);
 	ColorSourceFlagsND _albedo_source_flags = COLOR_SOURCE_FLAG_SINGLE_COLOR;
 
+	void _mark_changed();
+
 public:
-	virtual Color get_albedo_color_of_edge(const int64_t p_edge_index, const Ref<MeshND> &p_for_mesh);
+	uint64_t get_version() const { return _version; } // Internal use only, do not expose.
+	// Computes the albedo colors of all edges of the mesh at once, without touching the edge color cache.
+	// If the colors can't all be calculated, r_edge_colors only keeps the edges colored before the failure.
+	virtual void get_albedo_colors_of_edges(const Ref<MeshND> &p_for_mesh, PackedColorArray &r_edge_colors) const; // Internal use only, do not expose.
+	Color get_albedo_color_of_edge(const int64_t p_edge_index, const Ref<MeshND> &p_for_mesh);
 	bool is_default_material() const;
 
 	Color get_albedo_color() const { return _albedo_color; }
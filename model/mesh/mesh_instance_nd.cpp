@@ -10,6 +10,15 @@ void MeshInstanceND::_notification(int p_what) {
 		case NOTIFICATION_EXIT_TREE: {
 			RenderingServerND::get_singleton()->unregister_mesh_instance(this);
 		} break;
+		case NOTIFICATION_VISIBILITY_CHANGED: {
+			_update_visibility_in_rendering_server();
+		} break;
+	}
+}
+
+void MeshInstanceND::_update_visibility_in_rendering_server() {
+	if (is_inside_tree()) {
+		RenderingServerND::get_singleton()->update_mesh_instance_visibility(this);
 	}
 }
 
@@ -30,8 +39,20 @@ Ref<MaterialND> MeshInstanceND::get_material_override() const {
 	return _material_override;
 }
 
+void MeshInstanceND::_material_override_changed() {
+	_mark_redraw_needed();
+}
+
 void MeshInstanceND::set_material_override(const Ref<MaterialND> &p_material) {
+	const Callable material_changed_callable = callable_mp(this, &MeshInstanceND::_material_override_changed);
+	if (_material_override.is_valid() && _material_override->is_connected(StringName("changed"), material_changed_callable)) {
+		_material_override->disconnect(StringName("changed"), material_changed_callable);
+	}
 	_material_override = p_material;
+	if (_material_override.is_valid()) {
+		_material_override->connect(StringName("changed"), material_changed_callable);
+	}
+	_mark_redraw_needed();
 }
 
 Ref<MeshND> MeshInstanceND::get_mesh() const {
@@ -39,7 +60,15 @@ Ref<MeshND> MeshInstanceND::get_mesh() const {
 }
 
 void MeshInstanceND::set_mesh(const Ref<MeshND> &p_mesh) {
+	const Callable mesh_changed_callable = callable_mp(this, &MeshInstanceND::_update_visibility_in_rendering_server);
+	if (_mesh.is_valid() && _mesh->is_connected(StringName("changed"), mesh_changed_callable)) {
+		_mesh->disconnect(StringName("changed"), mesh_changed_callable);
+	}
 	_mesh = p_mesh;
+	if (_mesh.is_valid()) {
+		_mesh->connect(StringName("changed"), mesh_changed_callable);
+	}
+	_update_visibility_in_rendering_server();
 }
 
 Ref<RectND> MeshInstanceND::get_rect_bounds(const Ref<TransformND> &p_to_target) const {
@@ -9,6 +9,9 @@ class MeshInstanceND : public NodeND {
 	Ref<MaterialND> _material_override;
 	Ref<MeshND> _mesh;
 
+	void _update_visibility_in_rendering_server();
+	void _material_override_changed();
+
 protected:
 	static void _bind_methods();
 	void _notification(int p_what);
@@ -1,5 +1,6 @@
 #include "mesh_nd.h"
 
+#include "../../math/inline_vector_nd.h"
 #include "../../math/rect_nd.h"
 #include "../../math/vector_nd.h"
 #include "wire/array_wire_mesh_nd.h"
@@ -52,7 +53,10 @@ bool MeshND::is_mesh_data_valid() {
 }
 
 void MeshND::reset_mesh_data_validation() {
+	_version++;
 	_is_mesh_data_valid = false;
+	// Always emit, since mesh instances with invalid data wait for this signal to check the mesh again.
+	emit_changed();
 }
 
 bool MeshND::validate_mesh_data() {
@@ -77,7 +81,11 @@ void MeshND::validate_material_for_mesh(const Ref<MaterialND> &p_material) {
 Ref<ArrayWireMeshND> MeshND::to_array_wire_mesh() {
 	Ref<ArrayWireMeshND> wire_mesh;
 	wire_mesh.instantiate();
-	wire_mesh->set_vertices(get_vertices());
+	PackedFloat64Array vertices_flat;
+	int64_t vertex_count = 0;
+	int stride = 0;
+	get_vertices_flat_checked(vertices_flat, vertex_count, stride);
+	wire_mesh->set_vertices_flat(vertices_flat, vertex_count, stride);
 	wire_mesh->set_edge_indices(get_edge_indices());
 	wire_mesh->set_material(get_material());
 	return wire_mesh;
@@ -91,13 +99,26 @@ Ref<RectND> MeshND::get_rect_bounds() {
 	if (likely(!_is_rect_bounds_dirty)) {
 		return _rect_bounds;
 	}
-	const Vector<VectorN> vertices = get_vertices();
-	const int dimension = vertices.is_empty() ? 0 : vertices[0].size();
+	PackedFloat64Array vertices_flat;
+	int64_t vertex_count = 0;
+	int stride = 0;
+	get_vertices_flat_checked(vertices_flat, vertex_count, stride);
 	// Start by including the mesh's local origin always, even if the mesh does not cover that point.
-	_rect_bounds = RectND::from_position_size(VectorND::zero(dimension), VectorND::zero(dimension));
-	for (int vertex_index = 0; vertex_index < vertices.size(); vertex_index++) {
-		_rect_bounds->expand_self_to_point(vertices[vertex_index]);
+	InlineVectorN bounds_min(stride);
+	InlineVectorN bounds_max(stride);
+	const double *vertex_ptr = vertices_flat.ptr();
+	for (int64_t vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+		for (int axis = 0; axis < stride; axis++) {
+			const double value = vertex_ptr[axis];
+			if (value < bounds_min[axis]) {
+				bounds_min[axis] = value;
+			} else if (value > bounds_max[axis]) {
+				bounds_max[axis] = value;
+			}
+		}
+		vertex_ptr += stride;
 	}
+	_rect_bounds = RectND::from_position_end(bounds_min.to_vector_n(), bounds_max.to_vector_n());
 	_is_rect_bounds_dirty = false;
 	return _rect_bounds;
 }
@@ -107,7 +128,16 @@ Ref<MaterialND> MeshND::get_material() const {
 }
 
 void MeshND::set_material(const Ref<MaterialND> &p_material) {
+	// Forward material edits as changes of this mesh, so users of the mesh only need to watch one resource.
+	const Callable material_changed_callable = callable_mp((Resource *)this, &Resource::emit_changed);
+	if (_material.is_valid() && _material->is_connected(StringName("changed"), material_changed_callable)) {
+		_material->disconnect(StringName("changed"), material_changed_callable);
+	}
 	_material = p_material;
+	if (_material.is_valid()) {
+		_material->connect(StringName("changed"), material_changed_callable);
+	}
+	emit_changed();
 }
 
 PackedInt32Array MeshND::get_edge_indices() {
@@ -118,10 +148,23 @@ PackedInt32Array MeshND::get_edge_indices() {
 
 Vector<VectorN> MeshND::get_edge_positions() {
 	const PackedInt32Array edge_indices = get_edge_indices();
-	const Vector<VectorN> vertices = get_vertices();
+	PackedFloat64Array vertices_flat;
+	int64_t vertex_count = 0;
+	int stride = 0;
+	ERR_FAIL_COND_V(!get_vertices_flat_checked(vertices_flat, vertex_count, stride), Vector<VectorN>());
 	Vector<VectorN> edges;
-	for (const int32_t edge_index : edge_indices) {
-		edges.append(vertices[edge_index]);
+	edges.resize(edge_indices.size());
+	VectorN *edges_ptrw = edges.ptrw();
+	for (int64_t i = 0; i < edge_indices.size(); i++) {
+		const int32_t vertex_index = edge_indices[i];
+		ERR_FAIL_INDEX_V(vertex_index, vertex_count, Vector<VectorN>());
+		VectorN &edge_position = edges_ptrw[i];
+		edge_position.resize(stride);
+		const double *src = vertices_flat.ptr() + vertex_index * stride;
+		double *dest = edge_position.ptrw();
+		for (int axis = 0; axis < stride; axis++) {
+			dest[axis] = src[axis];
+		}
 	}
 	return edges;
 }
@@ -165,6 +208,37 @@ int MeshND::get_dimension() {
 	return vertices[0].size();
 }
 
+PackedFloat64Array MeshND::get_vertices_flat() {
+	return VectorND::flatten_array(get_vertices(), get_vertex_stride());
+}
+
+int64_t MeshND::get_vertex_count() {
+	return get_vertices().size();
+}
+
+int MeshND::get_vertex_stride() {
+	return get_dimension();
+}
+
+bool MeshND::get_vertices_flat_checked(PackedFloat64Array &r_vertices_flat, int64_t &r_vertex_count, int &r_vertex_stride) {
+	// The default accessors each fetch the vertices again, which may differ between calls for meshes
+	// implemented in scripts, so derive the count from the flat array instead of trusting it.
+	r_vertices_flat = get_vertices_flat();
+	r_vertex_stride = get_vertex_stride();
+	if (r_vertex_stride > 0) {
+		r_vertex_count = r_vertices_flat.size() / r_vertex_stride;
+	} else {
+		// Zero-dimensional vertices have no components, so only the mesh knows how many there are.
+		r_vertex_count = r_vertices_flat.is_empty() ? get_vertex_count() : -1;
+	}
+	if (unlikely(r_vertex_count < 0 || r_vertices_flat.size() != r_vertex_count * r_vertex_stride)) {
+		r_vertices_flat = PackedFloat64Array();
+		r_vertex_count = 0;
+		ERR_FAIL_V_MSG(false, "MeshND: The flat vertex array size must be a multiple of the vertex stride on mesh '" + get_name() + "'.");
+	}
+	return true;
+}
+
 void MeshND::_bind_methods() {
 	ClassDB::bind_static_method("MeshND", D_METHOD("deduplicate_edge_indices", "items"), &MeshND::deduplicate_edge_indices);
 	ClassDB::bind_method(D_METHOD("has_edge_indices", "first", "second"), &MeshND::has_edge_indices);
@@ -17,6 +17,8 @@ class MeshND : public Resource {
 
 	Ref<RectND> _rect_bounds;
 	Ref<MaterialND> _material;
+	// Incremented whenever the mesh data may have changed, so renderers can cache data derived from it.
+	uint64_t _version = 1;
 	bool _is_mesh_data_valid = false;
 	bool _is_rect_bounds_dirty = true;
 
@@ -32,6 +34,7 @@ public:
 	static PackedInt32Array deduplicate_edge_indices(const PackedInt32Array &p_items);
 	bool has_edge_indices(int p_first, int p_second);
 
+	uint64_t get_version() const { return _version; } // Internal use only, do not expose.
 	bool is_mesh_data_valid();
 	void reset_mesh_data_validation();
 	virtual void validate_material_for_mesh(const Ref<MaterialND> &p_material);
@@ -51,6 +54,16 @@ public:
 	TypedArray<VectorN> get_vertices_bind();
 	virtual int get_dimension();
 
+	// Contiguous vertex storage for C++ hot loops: vertex i occupies the components
+	// [i * stride, (i + 1) * stride) of the flat array, where stride is get_vertex_stride().
+	// Meshes that store vertices natively in this layout override these to avoid conversion.
+	virtual PackedFloat64Array get_vertices_flat();
+	virtual int64_t get_vertex_count();
+	virtual int get_vertex_stride();
+	// Internal use only, do not expose. Fetches the flat vertices once, with a vertex count that matches the
+	// flat array. On a mismatch, this prints an error and returns false with no vertices.
+	bool get_vertices_flat_checked(PackedFloat64Array &r_vertices_flat, int64_t &r_vertex_count, int &r_vertex_stride);
+
 	GDVIRTUAL0R(PackedInt32Array, _get_edge_indices);
 	GDVIRTUAL0R(TypedArray<VectorN>, _get_vertices);
 	GDVIRTUAL0R(bool, _validate_mesh_data);
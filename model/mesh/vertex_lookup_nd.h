@@ -0,0 +1,224 @@
+#pragma once
+
+#include "../../godot_nd_defines.h"
+
+#if GDEXTENSION
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#elif GODOT_MODULE
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#endif
+
+// Internal hash index over the vertices of an array mesh or OFF document, so that deduplicating an
+// appended vertex does not compare it against every existing vertex. Like VectorND, missing components are
+// treated as zero, so the index stays valid when the vertex stride grows. The owner must call clear()
+// whenever existing vertices change, and insert() for each vertex appended while the index is built.
+//
+// Approximate matching uses the same tolerance as Math::is_equal_approx, which is relative for
+// components with a magnitude above 1. To get a grid with a uniform cell size, components are mapped
+// to x for |x| < 1 and sign(x) * (1 + ln|x|) otherwise, where the tolerance is about CMP_EPSILON.
+// Grid cells are much wider than the tolerance, so a lookup usually probes only one cell, and only
+// components close to a cell border also probe the neighboring cell.
+class VertexLookupND {
+	static constexpr double CELL_SIZE = CMP_EPSILON * 16.0;
+	// Slightly more than CMP_EPSILON, to cover rounding and the asymmetry of Math::is_equal_approx.
+	static constexpr double PROBE_TOLERANCE = CMP_EPSILON * 1.01;
+	// Beyond this many components near a cell border, it is cheaper to compare against every vertex.
+	static constexpr int64_t MAX_AMBIGUOUS_AXES = 6;
+
+	struct AxisKeys {
+		int64_t axis = 0;
+		int64_t key = 0;
+		int64_t neighbor_key = 0;
+	};
+
+	HashMap<uint32_t, int32_t> _first_vertex_with_hash;
+	LocalVector<int32_t> _next_vertex_with_hash;
+	LocalVector<AxisKeys> _axis_keys_scratch;
+	bool _is_built = false;
+
+	static _FORCE_INLINE_ double _map_component(const double p_value) {
+		const double magnitude = Math::abs(p_value);
+		if (magnitude < 1.0) {
+			return p_value;
+		}
+		const double mapped = 1.0 + Math::log(magnitude);
+		return p_value < 0.0 ? -mapped : mapped;
+	}
+
+	static _FORCE_INLINE_ int64_t _quantize(const double p_mapped) {
+		return (int64_t)Math::round(p_mapped / CELL_SIZE);
+	}
+
+	// Writes the grid keys of all components with a non-zero key, or which are close enough to
+	// the border of the zero cell to need a neighbor probe. Returns the number of ambiguous axes.
+	int64_t _calculate_axis_keys(const double *p_vertex, const int64_t p_size, const bool p_with_neighbors) {
+		_axis_keys_scratch.clear();
+		int64_t ambiguous_count = 0;
+		for (int64_t axis = 0; axis < p_size; axis++) {
+			const double value = p_vertex[axis];
+			AxisKeys axis_keys;
+			axis_keys.axis = axis;
+			if (unlikely(!Math::is_finite(value))) {
+				// Infinity only equals itself, and NaN never equals anything, so one key per sign is enough.
+				axis_keys.key = value > 0.0 ? INT64_MAX : INT64_MIN;
+				axis_keys.neighbor_key = axis_keys.key;
+			} else {
+				const double mapped = _map_component(value);
+				axis_keys.key = _quantize(mapped);
+				axis_keys.neighbor_key = axis_keys.key;
+				if (p_with_neighbors) {
+					const int64_t low_key = _quantize(mapped - PROBE_TOLERANCE);
+					const int64_t high_key = _quantize(mapped + PROBE_TOLERANCE);
+					axis_keys.neighbor_key = low_key != axis_keys.key ? low_key : high_key;
+				}
+			}
+			if (axis_keys.neighbor_key != axis_keys.key) {
+				ambiguous_count++;
+			} else if (axis_keys.key == 0) {
+				continue;
+			}
+			_axis_keys_scratch.push_back(axis_keys);
+		}
+		return ambiguous_count;
+	}
+
+	// Hashes one combination of keys. Bit i of the mask selects the neighbor key of the i-th ambiguous axis.
+	// Axes with a zero key are skipped, so trailing zeros and padding don't change the hash.
+	uint32_t _hash_axis_keys(const uint64_t p_neighbor_mask) const {
+		uint32_t hash = HASH_MURMUR3_SEED;
+		int64_t ambiguous_index = 0;
+		for (const AxisKeys &axis_keys : _axis_keys_scratch) {
+			int64_t key = axis_keys.key;
+			if (axis_keys.neighbor_key != axis_keys.key) {
+				if (p_neighbor_mask & (uint64_t(1) << ambiguous_index)) {
+					key = axis_keys.neighbor_key;
+				}
+				ambiguous_index++;
+			}
+			if (key != 0) {
+				hash = hash_murmur3_one_64((uint64_t)axis_keys.axis, hash);
+				hash = hash_murmur3_one_64((uint64_t)key, hash);
+			}
+		}
+		return hash_fmix32(hash);
+	}
+
+	static bool _is_vertex_equal(const double *p_a, const int64_t p_a_size, const double *p_b, const int64_t p_b_size, const bool p_approx) {
+		const int64_t compare_size = MAX(p_a_size, p_b_size);
+		for (int64_t axis = 0; axis < compare_size; axis++) {
+			const double a = likely(axis < p_a_size) ? p_a[axis] : 0.0;
+			const double b = likely(axis < p_b_size) ? p_b[axis] : 0.0;
+			if (p_approx ? !Math::is_equal_approx(a, b) : a != b) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void _insert_hashed(const uint32_t p_hash, const int32_t p_index) {
+		int32_t *first = _first_vertex_with_hash.getptr(p_hash);
+		if (first) {
+			_next_vertex_with_hash[p_index] = *first;
+			*first = p_index;
+		} else {
+			_next_vertex_with_hash[p_index] = -1;
+			_first_vertex_with_hash.insert(p_hash, p_index);
+		}
+	}
+
+	// Shared by the flat array and VectorN array overloads, p_get_vertex(i, r_size) returns a pointer to vertex i.
+	template <typename TGetVertex>
+	int64_t _find(const TGetVertex &p_get_vertex, const double *p_vertex, const int64_t p_size, const bool p_approx) {
+		DEV_ASSERT(_is_built);
+		const int64_t ambiguous_count = _calculate_axis_keys(p_vertex, p_size, p_approx);
+		int64_t existing_size = 0;
+		if (unlikely(ambiguous_count > MAX_AMBIGUOUS_AXES)) {
+			const int64_t vertex_count = _next_vertex_with_hash.size();
+			for (int64_t i = 0; i < vertex_count; i++) {
+				const double *existing = p_get_vertex(i, existing_size);
+				if (_is_vertex_equal(existing, existing_size, p_vertex, p_size, p_approx)) {
+					return i;
+				}
+			}
+			return -1;
+		}
+		int64_t found = -1;
+		const uint64_t probe_count = uint64_t(1) << ambiguous_count;
+		for (uint64_t neighbor_mask = 0; neighbor_mask < probe_count; neighbor_mask++) {
+			const int32_t *first = _first_vertex_with_hash.getptr(_hash_axis_keys(neighbor_mask));
+			if (first == nullptr) {
+				continue;
+			}
+			for (int32_t i = *first; i >= 0; i = _next_vertex_with_hash[i]) {
+				// Chains are ordered from the newest vertex to the oldest, so keep looking for lower indices.
+				if (found >= 0 && i >= found) {
+					continue;
+				}
+				const double *existing = p_get_vertex(i, existing_size);
+				if (_is_vertex_equal(existing, existing_size, p_vertex, p_size, p_approx)) {
+					found = i;
+				}
+			}
+		}
+		return found;
+	}
+
+public:
+	bool is_built() const { return _is_built; }
+
+	void clear() {
+		_first_vertex_with_hash.clear();
+		_next_vertex_with_hash.clear();
+		_is_built = false;
+	}
+
+	void build(const double *p_vertices_flat, const int64_t p_vertex_count, const int p_stride) {
+		clear();
+		_first_vertex_with_hash.reserve(p_vertex_count);
+		_next_vertex_with_hash.reserve(p_vertex_count);
+		_is_built = true;
+		for (int64_t i = 0; i < p_vertex_count; i++) {
+			insert(p_vertices_flat + i * p_stride, p_stride, i);
+		}
+	}
+
+	void build(const Vector<VectorN> &p_vertices) {
+		clear();
+		const int64_t vertex_count = p_vertices.size();
+		_first_vertex_with_hash.reserve(vertex_count);
+		_next_vertex_with_hash.reserve(vertex_count);
+		_is_built = true;
+		for (int64_t i = 0; i < vertex_count; i++) {
+			insert(p_vertices[i].ptr(), p_vertices[i].size(), i);
+		}
+	}
+
+	// The index must be the number of vertices inserted so far.
+	void insert(const double *p_vertex, const int64_t p_size, const int64_t p_index) {
+		DEV_ASSERT(p_index == (int64_t)_next_vertex_with_hash.size());
+		_next_vertex_with_hash.push_back(-1);
+		_calculate_axis_keys(p_vertex, p_size, false);
+		_insert_hashed(_hash_axis_keys(0), p_index);
+	}
+
+	// Returns the lowest index of a vertex equal to the given vertex, or -1 if there is none,
+	// which is the same result as comparing against every vertex in order.
+	int64_t find(const double *p_vertices_flat, const int p_stride, const double *p_vertex, const int64_t p_size, const bool p_approx) {
+		return _find([p_vertices_flat, p_stride](const int64_t p_index, int64_t &r_size) {
+			r_size = p_stride;
+			return p_vertices_flat + p_index * p_stride;
+		},
+				p_vertex, p_size, p_approx);
+	}
+
+	int64_t find(const Vector<VectorN> &p_vertices, const VectorN &p_vertex, const bool p_approx) {
+		const VectorN *vertices_ptr = p_vertices.ptr();
+		return _find([vertices_ptr](const int64_t p_index, int64_t &r_size) {
+			r_size = vertices_ptr[p_index].size();
+			return vertices_ptr[p_index].ptr();
+		},
+				p_vertex.ptr(), p_vertex.size(), p_approx);
+	}
+};
@@ -2,12 +2,17 @@
 
 #include "../../../math/vector_nd.h"
 
+void ArrayWireMeshND::_set_vertex_stride(const int p_stride) {
+	_vertices_flat = VectorND::restride_flat_array(_vertices_flat, _vertex_stride, p_stride, _vertex_count);
+	_vertex_stride = p_stride;
+}
+
 bool ArrayWireMeshND::validate_mesh_data() {
 	const int64_t edge_indices_count = _edge_indices.size();
 	if (edge_indices_count % 2 != 0) {
 		return false; // Must be a multiple of 2.
 	}
-	const int64_t vertex_count = _vertices.size();
+	const int64_t vertex_count = _vertex_count;
 	for (int32_t edge_index : _edge_indices) {
 		if (edge_index < 0 || edge_index >= vertex_count) {
 			return false; // Edges must reference valid vertices.
@@ -34,16 +39,35 @@ void ArrayWireMeshND::append_edge_indices(int p_index_a, int p_index_b) {
 }
 
 int ArrayWireMeshND::append_vertex(const VectorN &p_vertex, const bool p_deduplicate_vertices) {
-	const int vertex_count = _vertices.size();
+	const int vertex_count = _vertex_count;
+	const int64_t input_size = p_vertex.size();
+	const double *input_ptr = p_vertex.ptr();
 	if (p_deduplicate_vertices) {
-		for (int i = 0; i < vertex_count; i++) {
-			if (VectorND::is_equal_approx(_vertices[i], p_vertex)) {
-				return i;
-			}
+		if (!_vertex_lookup.is_built()) {
+			_vertex_lookup.build(_vertices_flat.ptr(), _vertex_count, _vertex_stride);
+		}
+		// Equivalent to VectorND::is_equal_approx, where missing components are treated as zero.
+		const int64_t existing_index = _vertex_lookup.find(_vertices_flat.ptr(), _vertex_stride, input_ptr, input_size, true);
+		if (existing_index >= 0) {
+			return existing_index;
 		}
 	}
-	ERR_FAIL_COND_V(_vertices.size() > MAX_VERTICES, 2147483647);
-	_vertices.push_back(p_vertex);
+	ERR_FAIL_COND_V(_vertex_count > MAX_VERTICES, 2147483647);
+	if (input_size > _vertex_stride) {
+		// Existing vertices get padded, so cached positions derived from them are stale.
+		_set_vertex_stride(input_size);
+		wire_mesh_clear_cache();
+	}
+	_vertices_flat.resize((_vertex_count + 1) * _vertex_stride);
+	double *dest = _vertices_flat.ptrw() + _vertex_count * _vertex_stride;
+	for (int64_t axis = 0; axis < _vertex_stride; axis++) {
+		dest[axis] = axis < input_size ? input_ptr[axis] : 0.0;
+	}
+	_vertex_count++;
+	if (_vertex_lookup.is_built()) {
+		_vertex_lookup.insert(dest, _vertex_stride, vertex_count);
+	}
+	mark_rect_bounds_dirty();
 	reset_mesh_data_validation();
 	return vertex_count;
 }
@@ -68,19 +92,32 @@ PackedInt32Array ArrayWireMeshND::append_vertices_bind(const TypedArray<VectorN>
 
 void ArrayWireMeshND::merge_with(const Ref<ArrayWireMeshND> &p_other, const Ref<TransformND> &p_transform) {
 	const int start_edge_count = _edge_indices.size();
-	const int start_vertex_count = _vertices.size();
+	const int start_vertex_count = _vertex_count;
 	const int other_edge_count = p_other->_edge_indices.size();
-	const int other_vertex_count = p_other->_vertices.size();
+	const int other_vertex_count = p_other->_vertex_count;
 	const int end_edge_count = start_edge_count + other_edge_count;
-	const int end_vertex_count = start_vertex_count + other_vertex_count;
 	_edge_indices.resize(end_edge_count);
-	_vertices.resize(end_vertex_count);
 	for (int i = 0; i < other_edge_count; i++) {
 		_edge_indices.set(start_edge_count + i, p_other->_edge_indices[i] + start_vertex_count);
 	}
+	PackedFloat64Array other_transformed;
+	int other_stride = 0;
+	p_transform->xform_many_flat(p_other->_vertices_flat, other_vertex_count, p_other->_vertex_stride, other_transformed, other_stride);
+	if (other_stride > _vertex_stride) {
+		_set_vertex_stride(other_stride);
+	}
+	_vertices_flat.resize((start_vertex_count + other_vertex_count) * _vertex_stride);
+	const double *src = other_transformed.ptr();
+	double *dest = _vertices_flat.ptrw() + start_vertex_count * _vertex_stride;
 	for (int i = 0; i < other_vertex_count; i++) {
-		_vertices.set(start_vertex_count + i, p_transform->xform(p_other->_vertices[i]));
+		for (int axis = 0; axis < _vertex_stride; axis++) {
+			dest[axis] = axis < other_stride ? src[axis] : 0.0;
+		}
+		src += other_stride;
+		dest += _vertex_stride;
 	}
+	_vertex_count = start_vertex_count + other_vertex_count;
+	_vertex_lookup.clear();
 	Ref<MaterialND> self_material = get_material();
 	if (self_material.is_null()) {
 		set_material(p_other->get_material());
@@ -100,22 +137,39 @@ void ArrayWireMeshND::set_edge_indices(const PackedInt32Array &p_edge_indices) {
 }
 
 Vector<VectorN> ArrayWireMeshND::get_vertices() {
-	return _vertices;
+	return VectorND::unflatten_array(_vertices_flat, _vertex_stride, _vertex_count);
 }
 
 void ArrayWireMeshND::set_vertices(const Vector<VectorN> &p_vertices) {
 	ERR_FAIL_COND(p_vertices.size() > MAX_VERTICES);
-	_vertices = p_vertices;
+	int stride = 0;
+	for (const VectorN &vertex : p_vertices) {
+		stride = MAX(stride, (int)vertex.size());
+	}
+	_vertices_flat = VectorND::flatten_array(p_vertices, stride);
+	_vertex_count = p_vertices.size();
+	_vertex_stride = stride;
+	_vertex_lookup.clear();
 	wire_mesh_clear_cache();
 	reset_mesh_data_validation();
 }
 
 void ArrayWireMeshND::set_vertices_bind(const TypedArray<VectorN> &p_vertices) {
-	_vertices.clear();
-	_vertices.resize(p_vertices.size());
+	Vector<VectorN> vertices;
+	vertices.resize(p_vertices.size());
 	for (int i = 0; i < p_vertices.size(); i++) {
-		_vertices.set(i, p_vertices[i]);
+		vertices.set(i, p_vertices[i]);
 	}
+	set_vertices(vertices);
+}
+
+void ArrayWireMeshND::set_vertices_flat(const PackedFloat64Array &p_vertices_flat, const int64_t p_vertex_count, const int p_stride) {
+	ERR_FAIL_COND(p_vertex_count > MAX_VERTICES);
+	ERR_FAIL_COND_MSG(p_vertices_flat.size() != p_vertex_count * p_stride, "ArrayWireMeshND: Flat vertex array size must be the vertex count times the stride.");
+	_vertices_flat = p_vertices_flat;
+	_vertex_count = p_vertex_count;
+	_vertex_stride = p_stride;
+	_vertex_lookup.clear();
 	wire_mesh_clear_cache();
 	reset_mesh_data_validation();
 }
@@ -123,9 +177,8 @@ void ArrayWireMeshND::set_vertices_bind(const TypedArray<VectorN> &p_vertices) {
 void ArrayWireMeshND::set_dimension(int p_dimension) {
 	ERR_FAIL_COND_MSG(p_dimension < 0, "ArrayWireMeshND: Dimension must not be negative.");
 	ERR_FAIL_COND_MSG(p_dimension > 1000, "ArrayWireMeshND: Too many dimensions for wireframe mesh.");
-	for (int i = 0; i < _vertices.size(); i++) {
-		_vertices.set(i, VectorND::with_dimension(_vertices[i], p_dimension));
-	}
+	_set_vertex_stride(p_dimension);
+	_vertex_lookup.clear();
 	wire_mesh_clear_cache();
 	reset_mesh_data_validation();
 }
@@ -1,13 +1,21 @@
 #pragma once
 
 #include "../../../math/transform_nd.h"
+#include "../vertex_lookup_nd.h"
 #include "wire_mesh_nd.h"
 
 class ArrayWireMeshND : public WireMeshND {
 	GDCLASS(ArrayWireMeshND, WireMeshND);
 
 	PackedInt32Array _edge_indices;
-	Vector<VectorN> _vertices;
+	// Vertices are stored flat, _vertex_stride components each, see MeshND::get_vertices_flat().
+	PackedFloat64Array _vertices_flat;
+	int64_t _vertex_count = 0;
+	int _vertex_stride = 0;
+	// Index for deduplicating appended vertices, built on first use and cleared when existing vertices change.
+	VertexLookupND _vertex_lookup;
+
+	void _set_vertex_stride(const int p_stride);
 
 protected:
 	static void _bind_methods();
@@ -28,5 +36,11 @@ public:
 	virtual Vector<VectorN> get_vertices() override;
 	void set_vertices(const Vector<VectorN> &p_vertices);
 	void set_vertices_bind(const TypedArray<VectorN> &p_vertices);
+	virtual int get_dimension() override { return _vertex_stride; }
 	void set_dimension(int p_dimension);
+
+	virtual PackedFloat64Array get_vertices_flat() override { return _vertices_flat; }
+	virtual int64_t get_vertex_count() override { return _vertex_count; }
+	virtual int get_vertex_stride() override { return _vertex_stride; }
+	void set_vertices_flat(const PackedFloat64Array &p_vertices_flat, const int64_t p_vertex_count, const int p_stride);
 };
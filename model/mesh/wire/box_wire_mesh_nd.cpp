@@ -21,8 +21,9 @@ void BoxWireMeshND::set_size(const VectorN &p_size) {
 			_edge_indices_cache.clear();
 		}
 		_size = p_size;
-		_vertices_cache.clear();
+		_vertices_flat_cache.clear();
 		wire_mesh_clear_cache();
+		reset_mesh_data_validation();
 	}
 }
 
@@ -51,22 +52,33 @@ PackedInt32Array BoxWireMeshND::get_edge_indices() {
 }
 
 Vector<VectorN> BoxWireMeshND::get_vertices() {
-	if (_vertices_cache.is_empty()) {
+	return VectorND::unflatten_array(get_vertices_flat(), _size.size(), get_vertex_count());
+}
+
+PackedFloat64Array BoxWireMeshND::get_vertices_flat() {
+	if (_vertices_flat_cache.is_empty()) {
 		const uint64_t dimension = _size.size();
-		ERR_FAIL_COND_V_MSG(dimension > 30, _vertices_cache, "BoxWireMeshND: Too many dimensions for box vertices.");
+		ERR_FAIL_COND_V_MSG(dimension > 30, _vertices_flat_cache, "BoxWireMeshND: Too many dimensions for box vertices.");
 		const uint64_t vertex_count = uint64_t(1) << dimension;
 		const VectorN he = get_half_extents();
-		_vertices_cache.resize(vertex_count);
+		_vertices_flat_cache.resize(vertex_count * dimension);
+		double *vertex_ptr = _vertices_flat_cache.ptrw();
 		for (uint64_t i = 0; i < vertex_count; i++) {
-			VectorN vertex;
-			vertex.resize(he.size());
 			for (uint64_t j = 0; j < dimension; j++) {
-				vertex.set(j, (i & (uint64_t(1) << j)) ? he[j] : -he[j]);
+				vertex_ptr[j] = (i & (uint64_t(1) << j)) ? he[j] : -he[j];
 			}
-			_vertices_cache.set(i, vertex);
+			vertex_ptr += dimension;
 		}
 	}
-	return _vertices_cache;
+	return _vertices_flat_cache;
+}
+
+int64_t BoxWireMeshND::get_vertex_count() {
+	const uint64_t dimension = _size.size();
+	if (dimension > 30) {
+		return 0;
+	}
+	return int64_t(1) << dimension;
 }
 
 Ref<WireMeshND> BoxWireMeshND::to_wire_mesh() {
@@ -6,7 +6,7 @@ class BoxWireMeshND : public WireMeshND {
 	GDCLASS(BoxWireMeshND, WireMeshND);
 
 	PackedInt32Array _edge_indices_cache;
-	Vector<VectorN> _vertices_cache;
+	PackedFloat64Array _vertices_flat_cache;
 	VectorN _size;
 
 protected:
@@ -25,5 +25,9 @@ public:
 	virtual int get_dimension() override { return _size.size(); }
 	void set_dimension(int p_dimension);
 
+	virtual PackedFloat64Array get_vertices_flat() override;
+	virtual int64_t get_vertex_count() override;
+	virtual int get_vertex_stride() override { return _size.size(); }
+
 	virtual Ref<WireMeshND> to_wire_mesh() override;
 };
@@ -20,8 +20,9 @@ void OrthoplexWireMeshND::set_size(const VectorN &p_size) {
 			_edge_indices_cache.clear();
 		}
 		_size = p_size;
-		_vertices_cache.clear();
+		_vertices_flat_cache.clear();
 		wire_mesh_clear_cache();
+		reset_mesh_data_validation();
 	}
 }
 
@@ -55,23 +56,32 @@ PackedInt32Array OrthoplexWireMeshND::get_edge_indices() {
 }
 
 Vector<VectorN> OrthoplexWireMeshND::get_vertices() {
-	if (_vertices_cache.is_empty()) {
+	return VectorND::unflatten_array(get_vertices_flat(), _size.size(), get_vertex_count());
+}
+
+PackedFloat64Array OrthoplexWireMeshND::get_vertices_flat() {
+	if (_vertices_flat_cache.is_empty()) {
 		const int dimension = _size.size();
-		ERR_FAIL_COND_V_MSG(dimension > 10000, _vertices_cache, "OrthoplexWireMeshND: Too many dimensions for orthoplex.");
+		ERR_FAIL_COND_V_MSG(dimension > 10000, _vertices_flat_cache, "OrthoplexWireMeshND: Too many dimensions for orthoplex.");
 		const VectorN he = get_half_extents();
-		_vertices_cache.resize(dimension * 2);
+		// Vertex 2i is +he[i] on axis i, vertex 2i+1 is -he[i] on axis i, all other components zero.
+		_vertices_flat_cache.resize(dimension * 2 * dimension);
+		_vertices_flat_cache.fill(0.0);
+		double *vertex_ptr = _vertices_flat_cache.ptrw();
 		for (int i = 0; i < dimension; i++) {
-			VectorN positive;
-			positive.resize(dimension);
-			positive.set(i, he[i]);
-			_vertices_cache.set(i * 2, positive);
-			VectorN negative;
-			negative.resize(dimension);
-			negative.set(i, -he[i]);
-			_vertices_cache.set(i * 2 + 1, negative);
+			vertex_ptr[(i * 2) * dimension + i] = he[i];
+			vertex_ptr[(i * 2 + 1) * dimension + i] = -he[i];
 		}
 	}
-	return _vertices_cache;
+	return _vertices_flat_cache;
+}
+
+int64_t OrthoplexWireMeshND::get_vertex_count() {
+	const int dimension = _size.size();
+	if (dimension > 10000) {
+		return 0;
+	}
+	return dimension * 2;
 }
 
 Ref<WireMeshND> OrthoplexWireMeshND::to_wire_mesh() {
@@ -26,6 +26,7 @@ real_t WireMaterialND::get_line_thickness() const {
 
 void WireMaterialND::set_line_thickness(const real_t p_line_thickness) {
 	_line_thickness = p_line_thickness;
+	emit_changed();
 }
 
 void WireMaterialND::_bind_methods() {
@@ -7,13 +7,7 @@ void WireMeshND::wire_mesh_clear_cache() {
 
 Vector<VectorN> WireMeshND::get_edge_positions() {
 	if (_edge_positions_cache.is_empty()) {
-		const PackedInt32Array edge_indices = get_edge_indices();
-		const Vector<VectorN> vertices = get_vertices();
-		const int32_t vertices_count = vertices.size();
-		for (const int32_t edge_index : edge_indices) {
-			ERR_FAIL_INDEX_V(edge_index, vertices_count, _edge_positions_cache);
-			_edge_positions_cache.append(vertices[edge_index]);
-		}
+		_edge_positions_cache = MeshND::get_edge_positions();
 	}
 	return _edge_positions_cache;
 }
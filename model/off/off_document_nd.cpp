@@ -1,6 +1,7 @@
 #include "off_document_nd.h"
 
 #include "../../math/vector_nd.h"
+#include "../../parallel_chunks_nd.h"
 #include "../mesh/cell/cell_material_nd.h"
 #include "../mesh/mesh_instance_nd.h"
 #include "../mesh/wire/wire_material_nd.h"
@@ -10,46 +11,63 @@
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 #elif GODOT_MODULE
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #endif
 
+#include <string.h>
+
 void OFFDocumentND::_count_unique_edges_from_faces() {
 	_edge_count = 0;
 	if (_cell_face_indices.size() == 0) {
 		return;
 	}
+	// Read the faces by reference, copying each PackedInt32Array would add a refcount round trip per face.
+	const Vector<PackedInt32Array> &face_cell_indices = _cell_face_indices[0];
+	const int64_t face_count = face_cell_indices.size();
+	int64_t face_edge_count = 0;
+	for (int64_t face_number = 0; face_number < face_count; face_number++) {
+		face_edge_count += face_cell_indices[face_number].size();
+	}
 	HashSet<Vector2i> unique_items;
-	Vector<PackedInt32Array> face_cell_indices = _cell_face_indices[0];
-	for (int face_number = 0; face_number < face_cell_indices.size(); face_number++) {
-		PackedInt32Array face_vertex_indices = face_cell_indices[face_number];
-		for (int face_index = 0; face_index < face_vertex_indices.size(); face_index++) {
-			const int second_index = (face_index + 1) % face_vertex_indices.size();
-			Vector2i edge_indices = Vector2i(face_vertex_indices[face_index], face_vertex_indices[second_index]);
+	unique_items.reserve(face_edge_count);
+	for (int64_t face_number = 0; face_number < face_count; face_number++) {
+		const PackedInt32Array &face_vertex_indices = face_cell_indices[face_number];
+		const int32_t *face_ptr = face_vertex_indices.ptr();
+		const int64_t face_size = face_vertex_indices.size();
+		for (int64_t face_index = 0; face_index < face_size; face_index++) {
+			const int64_t second_index = face_index + 1 < face_size ? face_index + 1 : 0;
+			Vector2i edge_indices = Vector2i(face_ptr[face_index], face_ptr[second_index]);
 			if (edge_indices.x > edge_indices.y) {
 				SWAP(edge_indices.x, edge_indices.y);
 			}
-			if (unique_items.has(edge_indices)) {
-				continue;
-			}
 			unique_items.insert(edge_indices);
-			_edge_count++;
 		}
 	}
+	_edge_count = unique_items.size();
 }
 
 int64_t OFFDocumentND::_find_or_insert_vertex(const VectorN &p_vertex, const bool p_deduplicate_vertices) {
 	const int64_t vertex_count = _vertices.size();
 	if (p_deduplicate_vertices) {
-		for (int64_t vertex_number = 0; vertex_number < vertex_count; vertex_number++) {
-			if (VectorND::is_equal_exact(_vertices[vertex_number], p_vertex)) {
-				return vertex_number;
-			}
+		if (!_vertex_lookup.is_built()) {
+			_vertex_lookup.build(_vertices);
+		}
+		// Equivalent to VectorND::is_equal_exact, where missing components are treated as zero.
+		const int64_t existing_index = _vertex_lookup.find(_vertices, p_vertex, false);
+		if (existing_index >= 0) {
+			return existing_index;
 		}
 	}
 	_vertices.append(p_vertex);
+	if (_vertex_lookup.is_built()) {
+		_vertex_lookup.insert(p_vertex.ptr(), p_vertex.size(), vertex_count);
+	}
 	return vertex_count;
 }
 
@@ -232,24 +250,59 @@ Ref<ArrayWireMeshND> OFFDocumentND::import_generate_wire_mesh_nd(const bool p_de
 		wire_material->set_albedo_source(WireMaterialND::WIRE_COLOR_SOURCE_PER_EDGE_ONLY);
 		wire_mesh->set_material(wire_material);
 	}
-	Vector<PackedInt32Array> face_cell_indices = _cell_face_indices[0];
-	PackedColorArray face_colors = _cell_colors[0];
-	for (int face_number = 0; face_number < face_cell_indices.size(); face_number++) {
-		PackedInt32Array face_indices = face_cell_indices[face_number];
-		const int face_size = face_indices.size();
-		for (int face_index = 0; face_index < face_size; face_index++) {
-			const int second_index = (face_index + 1) % face_size;
+	// Collect all edges first and hand them to the mesh and material once, instead of per edge.
+	// Deduplication uses a hash set, since has_edge_indices() scans every edge added so far.
+	const Vector<PackedInt32Array> &face_cell_indices = _cell_face_indices[0];
+	const PackedColorArray &face_colors = _cell_colors[0];
+	const int64_t face_count = face_cell_indices.size();
+	int64_t face_edge_count = 0;
+	for (int64_t face_number = 0; face_number < face_count; face_number++) {
+		face_edge_count += face_cell_indices[face_number].size();
+	}
+	HashSet<Vector2i> unique_edges;
+	if (p_deduplicate_edges) {
+		unique_edges.reserve(face_edge_count);
+	}
+	PackedInt32Array edge_indices;
+	edge_indices.resize(face_edge_count * 2);
+	int32_t *edge_indices_ptrw = edge_indices.ptrw();
+	PackedColorArray edge_colors;
+	if (_has_any_cell_colors) {
+		edge_colors.resize(face_edge_count);
+	}
+	Color *edge_colors_ptrw = edge_colors.ptrw();
+	int64_t edge_count = 0;
+	for (int64_t face_number = 0; face_number < face_count; face_number++) {
+		const PackedInt32Array &face_indices = face_cell_indices[face_number];
+		const int32_t *face_ptr = face_indices.ptr();
+		const int64_t face_size = face_indices.size();
+		for (int64_t face_index = 0; face_index < face_size; face_index++) {
+			const int64_t second_index = face_index + 1 < face_size ? face_index + 1 : 0;
+			// Same order as ArrayWireMeshND::append_edge_indices(), which stores the lower index first.
+			Vector2i edge = Vector2i(face_ptr[face_index], face_ptr[second_index]);
+			if (edge.x > edge.y) {
+				SWAP(edge.x, edge.y);
+			}
 			if (p_deduplicate_edges) {
-				if (wire_mesh->has_edge_indices(face_indices[face_index], face_indices[second_index])) {
+				if (unique_edges.has(edge)) {
 					continue;
 				}
+				unique_edges.insert(edge);
 			}
-			wire_mesh->append_edge_indices(face_indices[face_index], face_indices[second_index]);
+			edge_indices_ptrw[edge_count * 2] = edge.x;
+			edge_indices_ptrw[edge_count * 2 + 1] = edge.y;
 			if (_has_any_cell_colors) {
-				wire_material->append_albedo_color(face_colors[face_number]);
+				edge_colors_ptrw[edge_count] = face_colors[face_number];
 			}
+			edge_count++;
 		}
 	}
+	edge_indices.resize(edge_count * 2);
+	wire_mesh->set_edge_indices(edge_indices);
+	if (_has_any_cell_colors) {
+		edge_colors.resize(edge_count);
+		wire_material->set_albedo_color_array(edge_colors);
+	}
 	return wire_mesh;
 }
 
@@ -261,6 +314,308 @@ Node *OFFDocumentND::import_generate_node(const bool p_deduplicate_edges) {
 	return mesh_instance_nd;
 }
 
+// Reads OFF data line by line straight from bytes, without building a String for the text, each line, or each token.
+// Data comes from a PackedByteArray without copying it, or from a file in chunks, so a large file is never fully in memory.
+class OFFLineReaderND {
+	static constexpr int64_t FILE_CHUNK_SIZE = 1 << 20;
+
+	Ref<FileAccess> _file;
+	int64_t _file_bytes_left = 0;
+	PackedByteArray _buffer;
+	const uint8_t *_data = nullptr;
+	int64_t _position = 0;
+	int64_t _size = 0;
+
+	bool _read_next_chunk() {
+		if (_file_bytes_left <= 0) {
+			return false;
+		}
+		// Keep the unfinished line at the start of the buffer, and read the next chunk after it.
+		const int64_t unfinished = _size - _position;
+		const int64_t chunk_size = MIN(FILE_CHUNK_SIZE, _file_bytes_left);
+		if (_buffer.size() < unfinished + chunk_size) {
+			_buffer.resize(unfinished + chunk_size);
+		}
+		uint8_t *buffer_ptrw = _buffer.ptrw();
+		memmove(buffer_ptrw, buffer_ptrw + _position, unfinished);
+#if GDEXTENSION
+		const PackedByteArray chunk = _file->get_buffer(chunk_size);
+		const int64_t read_size = chunk.size();
+		memcpy(buffer_ptrw + unfinished, chunk.ptr(), read_size);
+#elif GODOT_MODULE
+		const int64_t read_size = _file->get_buffer(buffer_ptrw + unfinished, chunk_size);
+#endif
+		_file_bytes_left = read_size < chunk_size ? 0 : _file_bytes_left - read_size;
+		_data = buffer_ptrw;
+		_position = 0;
+		_size = unfinished + read_size;
+		return read_size > 0;
+	}
+
+public:
+	bool found_carriage_return = false;
+
+	// Returns false after the last line. The line does not include the newline,
+	// and the pointer is only valid until the next call.
+	bool next_line(const uint8_t *&r_line, int64_t &r_length) {
+		while (true) {
+			const uint8_t *start = _data + _position;
+			const int64_t available = _size - _position;
+			const uint8_t *newline = available > 0 ? (const uint8_t *)memchr(start, '\n', available) : nullptr;
+			if (newline) {
+				r_line = start;
+				r_length = newline - start;
+				_position += r_length + 1;
+				return true;
+			}
+			if (_read_next_chunk()) {
+				continue;
+			}
+			if (available > 0) {
+				// The last line has no newline after it.
+				r_line = start;
+				r_length = available;
+				_position = _size;
+				return true;
+			}
+			return false;
+		}
+	}
+
+	explicit OFFLineReaderND(const PackedByteArray &p_data) {
+		_buffer = p_data;
+		_data = _buffer.ptr();
+		_size = _buffer.size();
+	}
+
+	explicit OFFLineReaderND(const Ref<FileAccess> &p_file) {
+		_file = p_file;
+		_file_bytes_left = p_file->get_length() - p_file->get_position();
+	}
+};
+
+struct OFFTokenND {
+	const uint8_t *start = nullptr;
+	int64_t length = 0;
+};
+
+static _FORCE_INLINE_ bool _is_off_whitespace(const uint8_t p_byte) {
+	return p_byte == ' ' || p_byte == '\t' || p_byte == '\r';
+}
+
+static _FORCE_INLINE_ bool _is_off_digit(const uint8_t p_byte) {
+	return p_byte >= '0' && p_byte <= '9';
+}
+
+// Splits a line into tokens. A token starting with '#' starts a comment, which ends the line.
+static void _tokenize_off_line(const uint8_t *p_line, const int64_t p_length, LocalVector<OFFTokenND> &r_tokens) {
+	r_tokens.clear();
+	int64_t i = 0;
+	while (i < p_length) {
+		while (i < p_length && _is_off_whitespace(p_line[i])) {
+			i++;
+		}
+		if (i >= p_length || p_line[i] == '#') {
+			return;
+		}
+		OFFTokenND token;
+		token.start = p_line + i;
+		while (i < p_length && !_is_off_whitespace(p_line[i])) {
+			i++;
+		}
+		token.length = p_line + i - token.start;
+		r_tokens.push_back(token);
+	}
+}
+
+static int64_t _parse_off_int(const OFFTokenND &p_token) {
+	int64_t i = 0;
+	bool negative = false;
+	if (i < p_token.length && (p_token.start[i] == '-' || p_token.start[i] == '+')) {
+		negative = p_token.start[i] == '-';
+		i++;
+	}
+	int64_t value = 0;
+	while (i < p_token.length && _is_off_digit(p_token.start[i])) {
+		value = value * 10 + (p_token.start[i] - '0');
+		i++;
+	}
+	return negative ? -value : value;
+}
+
+static double _parse_off_float(const OFFTokenND &p_token) {
+	// Powers of ten that are exactly representable as doubles.
+	static constexpr double EXACT_POWERS_OF_TEN[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	const uint8_t *p = p_token.start;
+	const int64_t length = p_token.length;
+	int64_t i = 0;
+	bool negative = false;
+	if (i < length && (p[i] == '-' || p[i] == '+')) {
+		negative = p[i] == '-';
+		i++;
+	}
+	uint64_t mantissa = 0;
+	int64_t exponent = 0;
+	bool has_digits = false;
+	bool is_exact = true;
+	while (i < length && _is_off_digit(p[i])) {
+		if (mantissa < (uint64_t(1) << 53) / 10) {
+			mantissa = mantissa * 10 + (p[i] - '0');
+		} else {
+			exponent++;
+			is_exact = false;
+		}
+		has_digits = true;
+		i++;
+	}
+	if (i < length && p[i] == '.') {
+		i++;
+		while (i < length && _is_off_digit(p[i])) {
+			if (mantissa < (uint64_t(1) << 53) / 10) {
+				mantissa = mantissa * 10 + (p[i] - '0');
+				exponent--;
+			} else if (p[i] != '0') {
+				is_exact = false;
+			}
+			has_digits = true;
+			i++;
+		}
+	}
+	if (i < length && (p[i] == 'e' || p[i] == 'E')) {
+		i++;
+		bool exponent_negative = false;
+		if (i < length && (p[i] == '-' || p[i] == '+')) {
+			exponent_negative = p[i] == '-';
+			i++;
+		}
+		int64_t written_exponent = 0;
+		bool has_exponent_digits = false;
+		while (i < length && _is_off_digit(p[i]) && written_exponent < 100000) {
+			written_exponent = written_exponent * 10 + (p[i] - '0');
+			has_exponent_digits = true;
+			i++;
+		}
+		is_exact = is_exact && has_exponent_digits;
+		exponent += exponent_negative ? -written_exponent : written_exponent;
+	}
+	// Exact when the mantissa fits in a double and the power of ten is exact, since then there is only one rounding.
+	// Anything else, such as long mantissas, large exponents, "inf", or malformed numbers, uses the String parser.
+	if (unlikely(!has_digits || !is_exact || i != length || exponent < -22 || exponent > 22)) {
+		return String::utf8((const char *)p, length).to_float();
+	}
+	double value = (double)mantissa;
+	value = exponent < 0 ? value / EXACT_POWERS_OF_TEN[-exponent] : value * EXACT_POWERS_OF_TEN[exponent];
+	return negative ? -value : value;
+}
+
+static void _parse_off_vertex(const LocalVector<OFFTokenND> &p_tokens, VectorN &r_vertex) {
+	const int64_t token_count = p_tokens.size();
+	r_vertex.resize(token_count);
+	double *vertex_ptrw = r_vertex.ptrw();
+	for (int64_t i = 0; i < token_count; i++) {
+		vertex_ptrw[i] = _parse_off_float(p_tokens[i]);
+	}
+}
+
+// Returns true if the cell has a color, which is stored as the 3 numbers after the indices on the range 0-255.
+static bool _parse_off_cell(const LocalVector<OFFTokenND> &p_tokens, PackedInt32Array &r_cell_indices, Color &r_color) {
+	const int64_t token_count = p_tokens.size();
+	const int64_t index_count = MAX(_parse_off_int(p_tokens[0]), (int64_t)0);
+	if (token_count > index_count) {
+		r_cell_indices.resize(index_count);
+		int32_t *cell_indices_ptrw = r_cell_indices.ptrw();
+		for (int64_t i = 0; i < index_count; i++) {
+			cell_indices_ptrw[i] = _parse_off_int(p_tokens[i + 1]);
+		}
+	}
+	if (token_count > index_count + 3) {
+		r_color = Color(_parse_off_int(p_tokens[index_count + 1]) / 255.0f, _parse_off_int(p_tokens[index_count + 2]) / 255.0f, _parse_off_int(p_tokens[index_count + 3]) / 255.0f);
+		return true;
+	}
+	r_color = Color(1.0f, 1.0f, 1.0f);
+	return false;
+}
+
+static bool _is_off_header_line(const uint8_t *p_line, const int64_t p_length) {
+	for (int64_t i = 0; i + 2 < p_length; i++) {
+		if (p_line[i] == 'O' && p_line[i + 1] == 'F' && p_line[i + 2] == 'F') {
+			return true;
+		}
+	}
+	return false;
+}
+
+enum class OFFLineKind : uint8_t {
+	SKIP, // Empty, whitespace, or a comment.
+	HEADER, // Contains "OFF", which declares the dimension.
+	INVALID, // Not enough items, skipped with a warning.
+	DATA,
+};
+
+// Classifies a line the same way for the serial and parallel readers, and tokenizes it unless it is skipped.
+static OFFLineKind _classify_off_line(const uint8_t *p_line, const int64_t p_length, const int p_min_items_per_line, LocalVector<OFFTokenND> &r_tokens) {
+	if (p_length == 0 || p_line[0] == '#') {
+		return OFFLineKind::SKIP;
+	}
+	if (_is_off_header_line(p_line, p_length)) {
+		return OFFLineKind::HEADER;
+	}
+	_tokenize_off_line(p_line, p_length, r_tokens);
+	if (r_tokens.size() == 0) {
+		return OFFLineKind::SKIP;
+	}
+	if ((int)r_tokens.size() < p_min_items_per_line) {
+		return OFFLineKind::INVALID;
+	}
+	return OFFLineKind::DATA;
+}
+
+static _FORCE_INLINE_ bool _is_off_carriage_return_line(const uint8_t *p_line, const int64_t p_length) {
+	return p_length > 0 && p_line[0] != '#' && p_line[p_length - 1] == '\r';
+}
+
+static int _parse_off_header_dimension(const uint8_t *p_line, const int64_t p_length) {
+	// "OFF" by itself is 3D OFF.
+	if (!_is_off_digit(p_line[0])) {
+		return 3;
+	}
+	OFFTokenND dimension_token;
+	dimension_token.start = p_line;
+	dimension_token.length = p_length;
+	return _parse_off_int(dimension_token);
+}
+
+static void _parse_off_size_line(const LocalVector<OFFTokenND> &p_tokens, int &r_vertex_count, int &r_edge_count, PackedInt32Array &r_cell_counts) {
+	const int item_count = p_tokens.size();
+	r_vertex_count = _parse_off_int(p_tokens[0]);
+	if (item_count == 2) {
+		// Special case: 2D OFF file with only vertices and components.
+		r_cell_counts.resize(1);
+		r_cell_counts.set(0, _parse_off_int(p_tokens[1]));
+	} else if (item_count > 2) {
+		// OFF stores sizes in the order 0D, 2D, 1D, 3D, 4D, ... :(
+		r_edge_count = _parse_off_int(p_tokens[2]);
+		// Read 2D from slot index 1 to change the order to 0D, 2D, 3D, 4D, ... :)
+		const int cell_counts_count = item_count - 2;
+		r_cell_counts.resize(cell_counts_count);
+		r_cell_counts.set(0, _parse_off_int(p_tokens[1]));
+		for (int i = 1; i < cell_counts_count; i++) {
+			r_cell_counts.set(i, _parse_off_int(p_tokens[i + 2]));
+		}
+	}
+}
+
+static void _warn_off_carriage_return(const String &p_path) {
+	WARN_PRINT("OFF import: Warning: OFF file " + p_path + " contains carriage return characters (\\r). Remove them to silence this warning.");
+}
+
+static void _warn_off_invalid_line(const String &p_path, const uint8_t *p_line, const int64_t p_length) {
+	WARN_PRINT("Warning: OFF file " + p_path + " contains invalid line: '" + String::utf8((const char *)p_line, p_length) + "'. Skipping this line and attempting to read the rest of the file anyway.");
+}
+
 enum class OFFDocumentNDReadState {
 	READ_SIZE,
 	READ_VERTICES,
@@ -269,20 +624,16 @@ enum class OFFDocumentNDReadState {
 
 Ref<OFFDocumentND> OFFDocumentND::import_load_from_byte_array(const PackedByteArray &p_data) {
 	ERR_FAIL_COND_V_MSG(p_data.is_empty(), Ref<OFFDocumentND>(), "OFF import: Error: Given byte array is empty.");
-#if GDEXTENSION
-	const String as_string = p_data.get_string_from_utf8();
-#elif GODOT_MODULE
-	String as_string;
-	if (p_data.size() > 0) {
-		const uint8_t *r = p_data.ptr();
-#if GODOT_VERSION_MAJOR == 4 && GODOT_VERSION_MINOR < 5
-		as_string.parse_utf8((const char *)r, p_data.size(), true);
-#else
-		as_string = String::utf8((const char *)r, p_data.size());
-#endif
+	if (p_data.size() >= PARALLEL_IMPORT_MIN_BYTES) {
+		return _import_load_parallel(p_data, "(in-memory data)");
 	}
-#endif
-	return OFFDocumentND::_import_load_from_raw_text(as_string, "(in-memory data)");
+	OFFLineReaderND reader = OFFLineReaderND(p_data);
+	return OFFDocumentND::_import_load_from_reader(reader, "(in-memory data)");
+}
+
+Ref<OFFDocumentND> OFFDocumentND::import_load_from_byte_array_parallel(const PackedByteArray &p_data) {
+	ERR_FAIL_COND_V_MSG(p_data.is_empty(), Ref<OFFDocumentND>(), "OFF import: Error: Given byte array is empty.");
+	return _import_load_parallel(p_data, "(in-memory data)");
 }
 
 Ref<OFFDocumentND> OFFDocumentND::import_load_from_file(const String &p_path) {
@@ -294,16 +645,26 @@ Ref<OFFDocumentND> OFFDocumentND::import_load_from_file(const String &p_path) {
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ, &err);
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<OFFDocumentND>(), "OFF import: Error: Could not open file " + p_path + ".");
 #endif
-	const String file_text = file->get_as_text();
-	return _import_load_from_raw_text(file_text, p_path);
+	const int64_t file_length = file->get_length();
+	if (file_length >= PARALLEL_IMPORT_MIN_BYTES) {
+		// The parallel reader needs all bytes at once, but that is still far less than the parsed document.
+#if GDEXTENSION
+		const PackedByteArray file_data = file->get_buffer(file_length);
+#elif GODOT_MODULE
+		PackedByteArray file_data;
+		file_data.resize(file_length);
+		file_data.resize(file->get_buffer(file_data.ptrw(), file_length));
+#endif
+		return _import_load_parallel(file_data, p_path);
+	}
+	OFFLineReaderND reader = OFFLineReaderND(file);
+	return _import_load_from_reader(reader, p_path);
 }
 
-Ref<OFFDocumentND> OFFDocumentND::_import_load_from_raw_text(const String &p_raw_text, const String &p_path) {
+Ref<OFFDocumentND> OFFDocumentND::_import_load_from_reader(OFFLineReaderND &p_reader, const String &p_path) {
 	Ref<OFFDocumentND> off_document;
 	off_document.instantiate();
 	OFFDocumentNDReadState read_state = OFFDocumentNDReadState::READ_SIZE;
-	Vector<PackedInt32Array> dim_cell_face_indices;
-	PackedColorArray dim_cell_colors;
 	// Index 0 is 2D cells (triangles), index 1 is 3D cells (tetrahedra), etc.
 	PackedInt32Array cell_counts;
 	int current_cell_dimension = 0;
@@ -312,101 +673,79 @@ Ref<OFFDocumentND> OFFDocumentND::_import_load_from_raw_text(const String &p_raw
 	int vertex_count = 0;
 	int min_items_per_line = 3;
 	bool can_warn = true;
-	if (p_raw_text.contains("\r")) {
-		WARN_PRINT("OFF import: Warning: OFF file " + p_path + " contains carriage return characters (\\r). Remove them to silence this warning.");
-		can_warn = false;
-	}
-	const PackedStringArray lines = p_raw_text.split("\n", false);
-	for (const String &line : lines) {
-		if (line.is_empty() || line.begins_with("#")) {
+	bool can_warn_carriage_return = true;
+	// Each dimension's cells are parsed straight into their slot in the document.
+	VectorN *vertices_ptrw = nullptr;
+	PackedInt32Array *cell_face_indices_ptrw = nullptr;
+	Color *cell_colors_ptrw = nullptr;
+	LocalVector<OFFTokenND> tokens;
+	const uint8_t *line = nullptr;
+	int64_t line_length = 0;
+	while (p_reader.next_line(line, line_length)) {
+		if (unlikely(can_warn_carriage_return && _is_off_carriage_return_line(line, line_length))) {
+			_warn_off_carriage_return(p_path);
+			can_warn_carriage_return = false;
+			can_warn = false;
+		}
+		const OFFLineKind line_kind = _classify_off_line(line, line_length, min_items_per_line, tokens);
+		if (line_kind == OFFLineKind::SKIP) {
 			continue;
 		}
-		if (line.contains("OFF")) {
-			// "OFF" by itself is 3D OFF.
-			if (line == "OFF" || !is_digit(line[0])) {
-				off_document->_dimension = 3;
-			} else {
-				const int declared_dimension = line.to_int();
-				off_document->_dimension = declared_dimension;
-				if (declared_dimension < 3) {
-					min_items_per_line = declared_dimension;
-				}
+		if (line_kind == OFFLineKind::HEADER) {
+			const int declared_dimension = _parse_off_header_dimension(line, line_length);
+			off_document->_dimension = declared_dimension;
+			if (declared_dimension < 3) {
+				min_items_per_line = declared_dimension;
 			}
 			continue;
 		}
-		PackedStringArray items = line.split(" ", false);
-		const int item_count = items.size();
-		if (item_count < min_items_per_line) {
+		if (line_kind == OFFLineKind::INVALID) {
 			if (can_warn) {
 				can_warn = false;
-				WARN_PRINT("Warning: OFF file " + p_path + " contains invalid line: '" + line + "'. Skipping this line and attempting to read the rest of the file anyway.");
+				_warn_off_invalid_line(p_path, line, line_length);
 			}
 			continue;
 		}
 		switch (read_state) {
 			case OFFDocumentNDReadState::READ_SIZE: {
-				vertex_count = items[0].to_int();
+				_parse_off_size_line(tokens, vertex_count, off_document->_edge_count, cell_counts);
+				ERR_FAIL_COND_V_MSG(vertex_count < 0, off_document, "OFF import: Error: OFF file " + p_path + " has a negative vertex count.");
 				off_document->_vertices.resize(vertex_count);
-				if (item_count == 2) {
-					// Special case: 2D OFF file with only vertices and components.
-					cell_counts.resize(1);
-					cell_counts.set(0, items[1].to_int());
-					off_document->_cell_face_indices.resize(1);
-					off_document->_cell_colors.resize(1);
-				} else if (item_count > 2) {
-					// OFF stores sizes in the order 0D, 2D, 1D, 3D, 4D, ... :(
-					off_document->_edge_count = items[2].to_int();
-					// Copy 2D to slot index 2 to change the order to 0D, 2D, 2D, 3D, 4D, ... :)
-					items.set(2, items[1]);
-					const int cell_counts_count = item_count - 2;
-					cell_counts.resize(cell_counts_count);
-					off_document->_cell_face_indices.resize(cell_counts_count);
-					off_document->_cell_colors.resize(cell_counts_count);
-					for (int i = 0; i < cell_counts_count; i++) {
-						cell_counts.set(i, items[i + 2].to_int());
-					}
-				}
-				read_state = OFFDocumentNDReadState::READ_VERTICES;
+				vertices_ptrw = off_document->_vertices.ptrw();
+				off_document->_cell_face_indices.resize(cell_counts.size());
+				off_document->_cell_colors.resize(cell_counts.size());
+				read_state = vertex_count > 0 ? OFFDocumentNDReadState::READ_VERTICES : OFFDocumentNDReadState::READ_CELLS;
 			} break;
 			case OFFDocumentNDReadState::READ_VERTICES: {
-				VectorN vertex;
-				vertex.resize(item_count);
-				for (int i = 0; i < item_count; i++) {
-					vertex.set(i, items[i].to_float());
-				}
-				off_document->_vertices.set(current_vertex_index, vertex);
+				_parse_off_vertex(tokens, vertices_ptrw[current_vertex_index]);
 				current_vertex_index++;
 				if (current_vertex_index >= vertex_count) {
 					read_state = OFFDocumentNDReadState::READ_CELLS;
 				}
 			} break;
 			case OFFDocumentNDReadState::READ_CELLS: {
-				if (dim_cell_face_indices.is_empty()) {
-					dim_cell_face_indices.resize(cell_counts[current_cell_dimension]);
-					dim_cell_colors.resize(cell_counts[current_cell_dimension]);
-				}
-				const int this_cell_count = items[0].to_int();
-				PackedInt32Array this_cell_indices;
-				if (item_count > this_cell_count) {
-					for (int i = 1; i <= this_cell_count; i++) {
-						this_cell_indices.append(items[i].to_int());
+				if (current_cell_index == 0) {
+					// Dimensions without any cells keep empty arrays.
+					while (current_cell_dimension < cell_counts.size() && cell_counts[current_cell_dimension] <= 0) {
+						current_cell_dimension++;
 					}
+					if (current_cell_dimension >= cell_counts.size()) {
+						return off_document;
+					}
+					const int dim_cell_count = cell_counts[current_cell_dimension];
+					Vector<PackedInt32Array> &dim_cell_face_indices = off_document->_cell_face_indices.ptrw()[current_cell_dimension];
+					PackedColorArray &dim_cell_colors = off_document->_cell_colors.ptrw()[current_cell_dimension];
+					dim_cell_face_indices.resize(dim_cell_count);
+					dim_cell_colors.resize(dim_cell_count);
+					cell_face_indices_ptrw = dim_cell_face_indices.ptrw();
+					cell_colors_ptrw = dim_cell_colors.ptrw();
 				}
-				dim_cell_face_indices.set(current_cell_index, this_cell_indices);
-				if (item_count > this_cell_count + 3) {
-					// The last 3 numbers are the cell color on the range 0-255.
-					dim_cell_colors.set(current_cell_index, Color(items[this_cell_count + 1].to_int() / 255.0f, items[this_cell_count + 2].to_int() / 255.0f, items[this_cell_count + 3].to_int() / 255.0f));
+				if (_parse_off_cell(tokens, cell_face_indices_ptrw[current_cell_index], cell_colors_ptrw[current_cell_index])) {
 					off_document->_has_any_cell_colors = true;
-				} else {
-					dim_cell_colors.set(current_cell_index, Color(1.0f, 1.0f, 1.0f));
 				}
 				current_cell_index++;
 				if (current_cell_index >= cell_counts[current_cell_dimension]) {
 					current_cell_index = 0;
-					off_document->_cell_face_indices.set(current_cell_dimension, dim_cell_face_indices);
-					off_document->_cell_colors.set(current_cell_dimension, dim_cell_colors);
-					dim_cell_face_indices = Vector<PackedInt32Array>();
-					dim_cell_colors = PackedColorArray();
 					current_cell_dimension++;
 					if (current_cell_dimension >= cell_counts.size()) {
 						return off_document;
@@ -418,6 +757,328 @@ Ref<OFFDocumentND> OFFDocumentND::_import_load_from_raw_text(const String &p_raw
 	return off_document;
 }
 
+// Parallel import runs in three passes over the bytes, each split into chunks for WorkerThreadPool:
+// 1. Find all newlines, which gives the start and end of every line.
+// 2. Classify every line after the size line, and count the data lines per chunk.
+// 3. Parse every data line into its slot, which is known from the prefix sum of the data line counts.
+// Everything the serial reader would do differently based on earlier lines, like warnings, is resolved between passes.
+struct OFFParallelImportParams {
+	const uint8_t *data = nullptr;
+	int64_t data_size = 0;
+	int64_t chunk_count = 0;
+	int64_t newline_count = 0;
+	// Pass 1.
+	const int64_t *chunk_newline_offsets = nullptr;
+	int64_t *newline_positions = nullptr;
+	// Pass 2 and 3, over the lines after the size line.
+	int64_t first_body_line = 0;
+	int64_t line_count = 0;
+	int min_items_per_line = 3;
+	uint8_t *line_kinds = nullptr;
+	int64_t *chunk_data_line_counts = nullptr;
+	int64_t *chunk_first_invalid_lines = nullptr;
+	int64_t *chunk_first_carriage_return_lines = nullptr;
+	uint8_t *chunk_has_header_lines = nullptr;
+	// Pass 3.
+	const int64_t *chunk_first_data_ordinals = nullptr;
+	int64_t vertex_count = 0;
+	int64_t total_cell_count = 0;
+	VectorN *vertices = nullptr;
+	const int64_t *cell_count_offsets = nullptr;
+	int64_t cell_dimension_count = 0;
+	PackedInt32Array **cell_face_indices = nullptr;
+	Color **cell_colors = nullptr;
+	uint8_t *chunk_has_cell_colors = nullptr;
+};
+
+static _FORCE_INLINE_ void _get_off_line(const OFFParallelImportParams &p_params, const int64_t p_line, const uint8_t *&r_line, int64_t &r_length) {
+	// Line i ends at newline i, and the last line may end at the end of the data instead.
+	const int64_t start = p_line == 0 ? 0 : p_params.newline_positions[p_line - 1] + 1;
+	const int64_t end = p_line < p_params.newline_count ? p_params.newline_positions[p_line] : p_params.data_size;
+	r_line = p_params.data + start;
+	r_length = end - start;
+}
+
+static void _count_off_newlines_chunk(void *p_userdata, uint32_t p_chunk) {
+	OFFParallelImportParams &params = *(OFFParallelImportParams *)p_userdata;
+	int64_t begin = 0;
+	int64_t end = 0;
+	ParallelChunksND::get_chunk_range(params.data_size, params.chunk_count, p_chunk, begin, end);
+	int64_t count = 0;
+	const uint8_t *newline = (const uint8_t *)memchr(params.data + begin, '\n', end - begin);
+	while (newline) {
+		count++;
+		const int64_t next = newline - params.data + 1;
+		newline = next < end ? (const uint8_t *)memchr(params.data + next, '\n', end - next) : nullptr;
+	}
+	params.chunk_data_line_counts[p_chunk] = count;
+}
+
+static void _index_off_newlines_chunk(void *p_userdata, uint32_t p_chunk) {
+	OFFParallelImportParams &params = *(OFFParallelImportParams *)p_userdata;
+	int64_t begin = 0;
+	int64_t end = 0;
+	ParallelChunksND::get_chunk_range(params.data_size, params.chunk_count, p_chunk, begin, end);
+	int64_t *write = params.newline_positions + params.chunk_newline_offsets[p_chunk];
+	const uint8_t *newline = (const uint8_t *)memchr(params.data + begin, '\n', end - begin);
+	while (newline) {
+		const int64_t position = newline - params.data;
+		*write++ = position;
+		newline = position + 1 < end ? (const uint8_t *)memchr(params.data + position + 1, '\n', end - position - 1) : nullptr;
+	}
+}
+
+static void _classify_off_lines_chunk(void *p_userdata, uint32_t p_chunk) {
+	OFFParallelImportParams &params = *(OFFParallelImportParams *)p_userdata;
+	int64_t begin = 0;
+	int64_t end = 0;
+	ParallelChunksND::get_chunk_range(params.line_count - params.first_body_line, params.chunk_count, p_chunk, begin, end);
+	LocalVector<OFFTokenND> tokens;
+	int64_t data_line_count = 0;
+	int64_t first_invalid_line = -1;
+	int64_t first_carriage_return_line = -1;
+	bool has_header_line = false;
+	for (int64_t line_index = params.first_body_line + begin; line_index < params.first_body_line + end; line_index++) {
+		const uint8_t *line = nullptr;
+		int64_t line_length = 0;
+		_get_off_line(params, line_index, line, line_length);
+		const OFFLineKind line_kind = _classify_off_line(line, line_length, params.min_items_per_line, tokens);
+		params.line_kinds[line_index] = (uint8_t)line_kind;
+		if (first_carriage_return_line < 0 && _is_off_carriage_return_line(line, line_length)) {
+			first_carriage_return_line = line_index;
+		}
+		if (line_kind == OFFLineKind::DATA) {
+			data_line_count++;
+		} else if (line_kind == OFFLineKind::INVALID && first_invalid_line < 0) {
+			first_invalid_line = line_index;
+		} else if (line_kind == OFFLineKind::HEADER) {
+			has_header_line = true;
+		}
+	}
+	params.chunk_data_line_counts[p_chunk] = data_line_count;
+	params.chunk_first_invalid_lines[p_chunk] = first_invalid_line;
+	params.chunk_first_carriage_return_lines[p_chunk] = first_carriage_return_line;
+	params.chunk_has_header_lines[p_chunk] = has_header_line;
+}
+
+static void _parse_off_lines_chunk(void *p_userdata, uint32_t p_chunk) {
+	OFFParallelImportParams &params = *(OFFParallelImportParams *)p_userdata;
+	int64_t begin = 0;
+	int64_t end = 0;
+	ParallelChunksND::get_chunk_range(params.line_count - params.first_body_line, params.chunk_count, p_chunk, begin, end);
+	LocalVector<OFFTokenND> tokens;
+	int64_t data_ordinal = params.chunk_first_data_ordinals[p_chunk];
+	const int64_t data_ordinal_end = params.vertex_count + params.total_cell_count;
+	int64_t cell_dimension = 0;
+	bool has_cell_colors = false;
+	for (int64_t line_index = params.first_body_line + begin; line_index < params.first_body_line + end && data_ordinal < data_ordinal_end; line_index++) {
+		if (params.line_kinds[line_index] != (uint8_t)OFFLineKind::DATA) {
+			continue;
+		}
+		const uint8_t *line = nullptr;
+		int64_t line_length = 0;
+		_get_off_line(params, line_index, line, line_length);
+		_tokenize_off_line(line, line_length, tokens);
+		if (data_ordinal < params.vertex_count) {
+			_parse_off_vertex(tokens, params.vertices[data_ordinal]);
+		} else {
+			const int64_t cell_ordinal = data_ordinal - params.vertex_count;
+			while (cell_ordinal >= params.cell_count_offsets[cell_dimension + 1]) {
+				cell_dimension++;
+			}
+			const int64_t cell_index = cell_ordinal - params.cell_count_offsets[cell_dimension];
+			if (_parse_off_cell(tokens, params.cell_face_indices[cell_dimension][cell_index], params.cell_colors[cell_dimension][cell_index])) {
+				has_cell_colors = true;
+			}
+		}
+		data_ordinal++;
+	}
+	params.chunk_has_cell_colors[p_chunk] = has_cell_colors;
+}
+
+Ref<OFFDocumentND> OFFDocumentND::_import_load_parallel(const PackedByteArray &p_data, const String &p_path) {
+	OFFParallelImportParams params;
+	params.data = p_data.ptr();
+	params.data_size = p_data.size();
+	// Pass 1: Count the newlines in each chunk of bytes, then write their positions after the prefix sum.
+	params.chunk_count = ParallelChunksND::get_chunk_count(params.data_size, 1 << 16);
+	LocalVector<int64_t> chunk_counts;
+	chunk_counts.resize(params.chunk_count);
+	params.chunk_data_line_counts = chunk_counts.ptr();
+	ParallelChunksND::run_chunks(&_count_off_newlines_chunk, &params, params.chunk_count, "OFFDocumentND: Count newlines");
+	LocalVector<int64_t> chunk_newline_offsets;
+	chunk_newline_offsets.resize(params.chunk_count);
+	for (int64_t chunk = 0; chunk < params.chunk_count; chunk++) {
+		chunk_newline_offsets[chunk] = params.newline_count;
+		params.newline_count += chunk_counts[chunk];
+	}
+	LocalVector<int64_t> newline_positions;
+	newline_positions.resize(params.newline_count);
+	params.chunk_newline_offsets = chunk_newline_offsets.ptr();
+	params.newline_positions = newline_positions.ptr();
+	ParallelChunksND::run_chunks(&_index_off_newlines_chunk, &params, params.chunk_count, "OFFDocumentND: Index newlines");
+	params.line_count = params.newline_count + (params.data[params.data_size - 1] == '\n' ? 0 : 1);
+	// Read the header and size lines serially, like the serial reader.
+	// Warnings are only decided at the end, since a header line after the size line falls back to the serial reader.
+	Ref<OFFDocumentND> off_document;
+	off_document.instantiate();
+	PackedInt32Array cell_counts;
+	int vertex_count = 0;
+	int64_t first_invalid_line = -1;
+	int64_t first_carriage_return_line = -1;
+	LocalVector<OFFTokenND> tokens;
+	bool has_size_line = false;
+	while (params.first_body_line < params.line_count && !has_size_line) {
+		const uint8_t *line = nullptr;
+		int64_t line_length = 0;
+		_get_off_line(params, params.first_body_line, line, line_length);
+		if (first_carriage_return_line < 0 && _is_off_carriage_return_line(line, line_length)) {
+			first_carriage_return_line = params.first_body_line;
+		}
+		const OFFLineKind line_kind = _classify_off_line(line, line_length, params.min_items_per_line, tokens);
+		if (line_kind == OFFLineKind::HEADER) {
+			off_document->_dimension = _parse_off_header_dimension(line, line_length);
+			if (off_document->_dimension < 3) {
+				params.min_items_per_line = off_document->_dimension;
+			}
+		} else if (line_kind == OFFLineKind::INVALID && first_invalid_line < 0) {
+			first_invalid_line = params.first_body_line;
+		} else if (line_kind == OFFLineKind::DATA) {
+			_parse_off_size_line(tokens, vertex_count, off_document->_edge_count, cell_counts);
+			has_size_line = true;
+		}
+		params.first_body_line++;
+	}
+	// Pass 2: Classify the remaining lines and count the data lines in each chunk.
+	const int64_t body_line_count = params.line_count - params.first_body_line;
+	params.chunk_count = ParallelChunksND::get_chunk_count(body_line_count, 1 << 12);
+	LocalVector<uint8_t> line_kinds;
+	line_kinds.resize(params.line_count);
+	LocalVector<int64_t> chunk_first_invalid_lines;
+	LocalVector<int64_t> chunk_first_carriage_return_lines;
+	LocalVector<uint8_t> chunk_flags;
+	chunk_counts.resize(params.chunk_count);
+	chunk_first_invalid_lines.resize(params.chunk_count);
+	chunk_first_carriage_return_lines.resize(params.chunk_count);
+	chunk_flags.resize(params.chunk_count);
+	params.line_kinds = line_kinds.ptr();
+	params.chunk_data_line_counts = chunk_counts.ptr();
+	params.chunk_first_invalid_lines = chunk_first_invalid_lines.ptr();
+	params.chunk_first_carriage_return_lines = chunk_first_carriage_return_lines.ptr();
+	params.chunk_has_header_lines = chunk_flags.ptr();
+	if (has_size_line && vertex_count >= 0 && params.chunk_count > 0) {
+		ParallelChunksND::run_chunks(&_classify_off_lines_chunk, &params, params.chunk_count, "OFFDocumentND: Classify lines");
+		for (int64_t chunk = 0; chunk < params.chunk_count; chunk++) {
+			if (chunk_flags[chunk]) {
+				// A header line changes how later lines are read, which only the serial reader handles.
+				OFFLineReaderND reader = OFFLineReaderND(p_data);
+				return _import_load_from_reader(reader, p_path);
+			}
+		}
+	}
+	// Map data lines to vertices and cells. The serial reader stops after the last cell, so anything after it is ignored.
+	// If the last cell dimension has no cells, it only stops at the data line after the last cell, when it finds no more cells to read.
+	const int64_t cell_dimension_count = cell_counts.size();
+	LocalVector<int64_t> cell_count_offsets;
+	cell_count_offsets.resize(cell_dimension_count + 1);
+	cell_count_offsets[0] = 0;
+	for (int64_t dim = 0; dim < cell_dimension_count; dim++) {
+		cell_count_offsets[dim + 1] = cell_count_offsets[dim] + MAX(cell_counts[dim], 0);
+	}
+	params.vertex_count = MAX(vertex_count, 0);
+	params.total_cell_count = cell_count_offsets[cell_dimension_count];
+	const int64_t data_ordinal_end = params.vertex_count + params.total_cell_count;
+	const bool stops_at_last_cell = cell_dimension_count > 0 && cell_counts[cell_dimension_count - 1] > 0;
+	const int64_t read_data_line_count = data_ordinal_end + (stops_at_last_cell ? 0 : 1);
+	LocalVector<int64_t> chunk_first_data_ordinals;
+	chunk_first_data_ordinals.resize(params.chunk_count);
+	int64_t data_line_count = 0;
+	int64_t last_read_line = params.first_body_line - 1;
+	for (int64_t chunk = 0; chunk < params.chunk_count && has_size_line && vertex_count >= 0; chunk++) {
+		chunk_first_data_ordinals[chunk] = data_line_count;
+		int64_t chunk_begin = 0;
+		int64_t chunk_end = 0;
+		ParallelChunksND::get_chunk_range(body_line_count, params.chunk_count, chunk, chunk_begin, chunk_end);
+		if (data_line_count + chunk_counts[chunk] < read_data_line_count) {
+			last_read_line = params.first_body_line + chunk_end - 1;
+		} else if (data_line_count < read_data_line_count) {
+			// The last data line the serial reader reads is in this chunk.
+			int64_t data_ordinal = data_line_count;
+			for (int64_t line_index = params.first_body_line + chunk_begin; line_index < params.first_body_line + chunk_end; line_index++) {
+				if (line_kinds[line_index] == (uint8_t)OFFLineKind::DATA && ++data_ordinal == read_data_line_count) {
+					last_read_line = line_index;
+					break;
+				}
+			}
+		}
+		if (data_line_count < read_data_line_count) {
+			if (chunk_first_invalid_lines[chunk] >= 0 && first_invalid_line < 0) {
+				first_invalid_line = chunk_first_invalid_lines[chunk];
+			}
+			if (chunk_first_carriage_return_lines[chunk] >= 0 && first_carriage_return_line < 0) {
+				first_carriage_return_line = chunk_first_carriage_return_lines[chunk];
+			}
+		}
+		data_line_count += chunk_counts[chunk];
+	}
+	// Emit the same warnings as the serial reader, which stops warning about invalid lines after a carriage return.
+	if (first_invalid_line > last_read_line) {
+		first_invalid_line = -1;
+	}
+	if (first_carriage_return_line > last_read_line) {
+		first_carriage_return_line = -1;
+	}
+	if (first_invalid_line >= 0 && (first_carriage_return_line < 0 || first_invalid_line < first_carriage_return_line)) {
+		const uint8_t *line = nullptr;
+		int64_t line_length = 0;
+		_get_off_line(params, first_invalid_line, line, line_length);
+		_warn_off_invalid_line(p_path, line, line_length);
+	}
+	if (first_carriage_return_line >= 0) {
+		_warn_off_carriage_return(p_path);
+	}
+	if (!has_size_line) {
+		return off_document;
+	}
+	ERR_FAIL_COND_V_MSG(vertex_count < 0, off_document, "OFF import: Error: OFF file " + p_path + " has a negative vertex count.");
+	// Allocate the slots, but like the serial reader, only the cell dimensions it would have reached.
+	off_document->_vertices.resize(vertex_count);
+	off_document->_cell_face_indices.resize(cell_dimension_count);
+	off_document->_cell_colors.resize(cell_dimension_count);
+	const int64_t read_cell_count = CLAMP(data_line_count - params.vertex_count, (int64_t)0, params.total_cell_count);
+	LocalVector<PackedInt32Array *> cell_face_indices_ptrs;
+	LocalVector<Color *> cell_colors_ptrs;
+	cell_face_indices_ptrs.resize(cell_dimension_count);
+	cell_colors_ptrs.resize(cell_dimension_count);
+	for (int64_t dim = 0; dim < cell_dimension_count; dim++) {
+		cell_face_indices_ptrs[dim] = nullptr;
+		cell_colors_ptrs[dim] = nullptr;
+		if (cell_counts[dim] > 0 && cell_count_offsets[dim] < read_cell_count) {
+			Vector<PackedInt32Array> &dim_cell_face_indices = off_document->_cell_face_indices.ptrw()[dim];
+			PackedColorArray &dim_cell_colors = off_document->_cell_colors.ptrw()[dim];
+			dim_cell_face_indices.resize(cell_counts[dim]);
+			dim_cell_colors.resize(cell_counts[dim]);
+			cell_face_indices_ptrs[dim] = dim_cell_face_indices.ptrw();
+			cell_colors_ptrs[dim] = dim_cell_colors.ptrw();
+		}
+	}
+	// Pass 3: Parse every data line into its slot.
+	if (params.chunk_count > 0) {
+		params.chunk_first_data_ordinals = chunk_first_data_ordinals.ptr();
+		params.vertices = off_document->_vertices.ptrw();
+		params.cell_count_offsets = cell_count_offsets.ptr();
+		params.cell_dimension_count = cell_dimension_count;
+		params.cell_face_indices = cell_face_indices_ptrs.ptr();
+		params.cell_colors = cell_colors_ptrs.ptr();
+		params.chunk_has_cell_colors = chunk_flags.ptr();
+		ParallelChunksND::run_chunks(&_parse_off_lines_chunk, &params, params.chunk_count, "OFFDocumentND: Parse lines");
+		for (int64_t chunk = 0; chunk < params.chunk_count; chunk++) {
+			off_document->_has_any_cell_colors = off_document->_has_any_cell_colors || chunk_flags[chunk];
+		}
+	}
+	return off_document;
+}
+
 String OFFDocumentND::_vector_n_to_off_nd(const VectorN &p_vertex) {
 	ERR_FAIL_COND_V(p_vertex.size() == 0, String());
 	String ret = String::num(p_vertex[0]);
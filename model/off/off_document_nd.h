@@ -2,6 +2,7 @@
 
 #include "../../godot_nd_defines.h"
 #include "../mesh/cell/array_cell_mesh_nd.h"
+#include "../mesh/vertex_lookup_nd.h"
 #include "../mesh/wire/array_wire_mesh_nd.h"
 
 #if GDEXTENSION
@@ -12,12 +13,19 @@
 #include "scene/resources/mesh.h"
 #endif
 
+class OFFLineReaderND;
+
 class OFFDocumentND : public Resource {
 	GDCLASS(OFFDocumentND, Resource);
 
+	// Files at least this large are split into lines and parsed on the WorkerThreadPool.
+	static constexpr int64_t PARALLEL_IMPORT_MIN_BYTES = 4 << 20;
+
 	Vector<PackedColorArray> _cell_colors;
 	Vector<Vector<PackedInt32Array>> _cell_face_indices;
 	Vector<VectorN> _vertices;
+	// Built on the first deduplicated insert, and cleared when the vertices are replaced.
+	VertexLookupND _vertex_lookup;
 	int _dimension = 3;
 	int _edge_count = 0;
 	bool _has_any_cell_colors = false;
@@ -33,7 +41,8 @@ class OFFDocumentND : public Resource {
 	Vector<Vector<PackedInt32Array>> _calculate_simplex_vertex_indices(const Vector<Vector<PackedInt32Array>> &p_cell_vertex_indices);
 
 	String _export_save_to_string();
-	static Ref<OFFDocumentND> _import_load_from_raw_text(const String &p_raw_text, const String &p_path);
+	static Ref<OFFDocumentND> _import_load_from_reader(OFFLineReaderND &p_reader, const String &p_path);
+	static Ref<OFFDocumentND> _import_load_parallel(const PackedByteArray &p_data, const String &p_path);
 
 protected:
 	static void _bind_methods();
@@ -44,6 +53,8 @@ public:
 
 	static Ref<OFFDocumentND> import_load_from_byte_array(const PackedByteArray &p_data);
 	static Ref<OFFDocumentND> import_load_from_file(const String &p_path);
+	// Internal use only, do not expose. Parallel import regardless of size, gives the same result as the serial import.
+	static Ref<OFFDocumentND> import_load_from_byte_array_parallel(const PackedByteArray &p_data);
 	Ref<ArrayCellMeshND> import_generate_array_cell_mesh_nd();
 	Ref<ArrayWireMeshND> import_generate_wire_mesh_nd(const bool p_deduplicate_edges = true);
 	Node *import_generate_node(const bool p_deduplicate_edges = true);
@@ -58,5 +69,8 @@ public:
 	void set_edge_count(const int p_edge_count) { _edge_count = p_edge_count; }
 
 	Vector<VectorN> get_vertices() const { return _vertices; }
-	void set_vertices(const Vector<VectorN> &p_vertices) { _vertices = p_vertices; }
+	void set_vertices(const Vector<VectorN> &p_vertices) {
+		_vertices = p_vertices;
+		_vertex_lookup.clear();
+	}
 };
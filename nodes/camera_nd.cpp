@@ -90,6 +90,7 @@ void CameraND::make_current() {
 
 void CameraND::set_depth_fade(const bool p_depth_fade) {
 	_use_depth_fade = p_depth_fade;
+	_mark_redraw_needed();
 }
 
 bool CameraND::get_depth_fade() const {
@@ -98,6 +99,7 @@ bool CameraND::get_depth_fade() const {
 
 void CameraND::set_depth_fade_start(const double p_depth_fade_start) {
 	_depth_fade_start = p_depth_fade_start;
+	_mark_redraw_needed();
 }
 
 double CameraND::get_depth_fade_start() const {
@@ -158,12 +160,16 @@ VectorN CameraND::viewport_to_world_ray_direction(const Vector2 &p_viewport_posi
 }
 
 Vector2 CameraND::world_to_viewport_local_normal(const VectorN &p_local_position, const bool p_force_orthographic) const {
-	const double x = p_local_position.size() > 0 ? p_local_position[0] : 0.0;
-	const double y = p_local_position.size() > 1 ? p_local_position[1] : 0.0;
+	return world_to_viewport_local_normal_ptr(p_local_position.ptr(), p_local_position.size(), p_force_orthographic);
+}
+
+Vector2 CameraND::world_to_viewport_local_normal_ptr(const double *p_local_position, const int64_t p_dimension, const bool p_force_orthographic) const {
+	const double x = p_dimension > 0 ? p_local_position[0] : 0.0;
+	const double y = p_dimension > 1 ? p_local_position[1] : 0.0;
 	if (p_force_orthographic || _projection_type == CameraND::PROJECTION_ORTHOGRAPHIC) {
 		return Vector2(x, -y) / _orthographic_size;
 	}
-	const double z = p_local_position.size() > 2 ? p_local_position[2] : 0.0;
+	const double z = p_dimension > 2 ? p_local_position[2] : 0.0;
 	// -Z is forward, so this will "flip" X and Y. We need Y flipped anyway, but X needs to be flipped back.
 	return Vector2(-x, y) * (_focal_length / z);
 }
@@ -180,12 +186,154 @@ Vector2 CameraND::world_to_viewport(const VectorN &p_global_position) const {
 	return (projected * pixel_size + viewport_size) * 0.5f;
 }
 
+PackedVector2Array CameraND::project_many(const PackedFloat64Array &p_local_vertices_flat, const int p_stride, const bool p_force_orthographic) const {
+	PackedVector2Array projected;
+	ERR_FAIL_COND_V_MSG(p_stride <= 0, projected, "CameraND: Stride must be positive.");
+	ERR_FAIL_COND_V_MSG(p_local_vertices_flat.size() % p_stride != 0, projected, "CameraND: Flat vertex array size must be a multiple of the stride.");
+	const int64_t vertex_count = p_local_vertices_flat.size() / p_stride;
+	projected.resize(vertex_count);
+	project_many_ptr(p_local_vertices_flat.ptr(), vertex_count, p_stride, p_force_orthographic, Vector2(1.0f, 1.0f), Vector2(), projected.ptrw());
+	return projected;
+}
+
+Dictionary CameraND::project_many_dict(const PackedFloat64Array &p_local_vertices_flat, const int p_stride, const bool p_force_orthographic) const {
+	Dictionary result;
+	ERR_FAIL_COND_V_MSG(p_stride <= 0, result, "CameraND: Stride must be positive.");
+	ERR_FAIL_COND_V_MSG(p_local_vertices_flat.size() % p_stride != 0, result, "CameraND: Flat vertex array size must be a multiple of the stride.");
+	const int64_t vertex_count = p_local_vertices_flat.size() / p_stride;
+	PackedVector2Array projected;
+	projected.resize(vertex_count);
+	PackedFloat64Array distances;
+	distances.resize(vertex_count);
+	// Components beyond XYZ are stored contiguously, with p_stride - 3 numbers per vertex.
+	PackedFloat64Array perp_components;
+	perp_components.resize(vertex_count * MAX(p_stride - 3, 0));
+	project_many_ptr(p_local_vertices_flat.ptr(), vertex_count, p_stride, p_force_orthographic, Vector2(1.0f, 1.0f), Vector2(), projected.ptrw(), distances.ptrw(), perp_components.ptrw());
+	result["projected"] = projected;
+	result["distances"] = distances;
+	result["perpendicular_components"] = perp_components;
+	return result;
+}
+
+void CameraND::project_many_ptr(const double *p_local_vertices, const int64_t p_vertex_count, const int p_stride, const bool p_force_orthographic, const Vector2 &p_scale, const Vector2 &p_offset, Vector2 *r_projected, double *r_distances, double *r_perp_components) const {
+	// The projection type is only checked once, and its constants are folded together with the scale.
+	// Vertices without a Z component can't be projected with perspective, so they are mapped directly.
+	if (p_force_orthographic || _projection_type == CameraND::PROJECTION_ORTHOGRAPHIC || p_stride < 3) {
+		const double scale_x = p_scale.x / _orthographic_size;
+		const double scale_y = -p_scale.y / _orthographic_size;
+		for (int64_t i = 0; i < p_vertex_count; i++) {
+			const double *vertex = p_local_vertices + i * p_stride;
+			const double x = p_stride > 0 ? vertex[0] : 0.0;
+			const double y = p_stride > 1 ? vertex[1] : 0.0;
+			r_projected[i] = Vector2(x * scale_x + p_offset.x, y * scale_y + p_offset.y);
+		}
+	} else {
+		const double scale_x = -_focal_length * p_scale.x;
+		const double scale_y = _focal_length * p_scale.y;
+		for (int64_t i = 0; i < p_vertex_count; i++) {
+			const double *vertex = p_local_vertices + i * p_stride;
+			const double inverse_z = 1.0 / vertex[2];
+			r_projected[i] = Vector2(vertex[0] * scale_x * inverse_z + p_offset.x, vertex[1] * scale_y * inverse_z + p_offset.y);
+		}
+	}
+	if (r_distances != nullptr) {
+		for (int64_t i = 0; i < p_vertex_count; i++) {
+			const double *vertex = p_local_vertices + i * p_stride;
+			double length_squared = 0.0;
+			for (int axis = 0; axis < p_stride; axis++) {
+				length_squared += vertex[axis] * vertex[axis];
+			}
+			r_distances[i] = Math::sqrt(length_squared);
+		}
+	}
+	if (r_perp_components != nullptr && p_stride > 3) {
+		const int perp_stride = p_stride - 3;
+		for (int64_t i = 0; i < p_vertex_count; i++) {
+			const double *vertex = p_local_vertices + i * p_stride + 3;
+			double *perp = r_perp_components + i * perp_stride;
+			for (int axis = 0; axis < perp_stride; axis++) {
+				perp[axis] = vertex[axis];
+			}
+		}
+	}
+}
+
+Vector2 CameraND::get_view_half_extents(const Vector2 &p_viewport_size) const {
+	const double pixel_size = _keep_aspect == KEEP_WIDTH ? p_viewport_size.x : p_viewport_size.y;
+	if (pixel_size <= 0.0) {
+		return Vector2();
+	}
+	return p_viewport_size / pixel_size;
+}
+
+bool CameraND::is_local_rect_outside_view(const Ref<RectND> &p_local_rect, const Vector2 &p_view_half_extents) const {
+	ERR_FAIL_COND_V(p_local_rect.is_null(), false);
+	const int dimension = p_local_rect->get_dimension();
+	if (dimension < 3) {
+		// 0D, 1D, and 2D relative positions are projected directly without clipping, so never cull them.
+		return false;
+	}
+	const VectorN rect_min = p_local_rect->get_position();
+	const VectorN rect_max = p_local_rect->get_end();
+	// -Z is forward. Everything with Z above -near is clipped, and beyond the far plane is not drawn.
+	const double z_min = rect_min[2];
+	const double z_max = rect_max[2];
+	if (z_min > -_clip_near || z_max < -_clip_far) {
+		return true;
+	}
+	// Side hyperplanes. Only X and Y are projected onto the screen, the other axes only affect fading.
+	if (_projection_type == PROJECTION_ORTHOGRAPHIC) {
+		const double half_x = p_view_half_extents.x * _orthographic_size;
+		const double half_y = p_view_half_extents.y * _orthographic_size;
+		if (rect_min[0] > half_x || rect_max[0] < -half_x || rect_min[1] > half_y || rect_max[1] < -half_y) {
+			return true;
+		}
+	} else if (_focal_length > 0.0) {
+		// A point is inside when focal_length * abs(x) <= half_x * depth, where depth is -z. The box is outside
+		// a hyperplane when even its corner with the lowest signed distance is outside, which uses z_min here.
+		if (_focal_length * rect_min[0] + p_view_half_extents.x * z_min > 0.0) {
+			return true;
+		}
+		if (-_focal_length * rect_max[0] + p_view_half_extents.x * z_min > 0.0) {
+			return true;
+		}
+		if (_focal_length * rect_min[1] + p_view_half_extents.y * z_min > 0.0) {
+			return true;
+		}
+		if (-_focal_length * rect_max[1] + p_view_half_extents.y * z_min > 0.0) {
+			return true;
+		}
+	}
+	// With transparency fading, edges are invisible when the perpendicular distance reaches the fade denominator.
+	if ((_perp_fade_mode & PERP_FADE_TRANSPARENCY) && dimension > 3) {
+		double min_perp_length_squared = 0.0;
+		for (int i = 3; i < dimension; i++) {
+			double nearest = 0.0;
+			if (rect_min[i] > 0.0) {
+				nearest = rect_min[i];
+			} else if (rect_max[i] < 0.0) {
+				nearest = rect_max[i];
+			}
+			min_perp_length_squared += nearest * nearest;
+		}
+		double max_fade_denom = _perp_fade_distance;
+		if (_projection_type == PROJECTION_PERSPECTIVE) {
+			max_fade_denom += MAX(_perp_fade_slope * -z_min, _perp_fade_slope * -z_max);
+		}
+		if (max_fade_denom > 0.0 && min_perp_length_squared >= max_fade_denom * max_fade_denom) {
+			return true;
+		}
+	}
+	return false;
+}
+
 String CameraND::get_rendering_engine_name() const {
 	return _rendering_engine_name;
 }
 
 void CameraND::set_rendering_engine_name(const String &p_rendering_engine_name) {
 	_rendering_engine_name = p_rendering_engine_name;
+	_mark_redraw_needed();
 }
 
 CameraND::KeepAspect CameraND::get_keep_aspect() const {
@@ -194,6 +342,7 @@ CameraND::KeepAspect CameraND::get_keep_aspect() const {
 
 void CameraND::set_keep_aspect(const KeepAspect p_keep_aspect) {
 	_keep_aspect = p_keep_aspect;
+	_mark_redraw_needed();
 }
 
 CameraND::ProjectionType CameraND::get_projection_type() const {
@@ -202,6 +351,7 @@ CameraND::ProjectionType CameraND::get_projection_type() const {
 
 void CameraND::set_projection_type(const ProjectionType p_projection_type_nd) {
 	_projection_type = p_projection_type_nd;
+	_mark_redraw_needed();
 	notify_property_list_changed();
 }
 
@@ -211,6 +361,7 @@ CameraND::ViewAngleType CameraND::get_view_angle_type() const {
 
 void CameraND::set_view_angle_type(const ViewAngleType p_view_angle_type) {
 	_view_angle_type = p_view_angle_type;
+	_mark_redraw_needed();
 	notify_property_list_changed();
 }
 
@@ -220,6 +371,7 @@ double CameraND::get_focal_length() const {
 
 void CameraND::set_focal_length(const double p_focal_length_nd) {
 	_focal_length = p_focal_length_nd;
+	_mark_redraw_needed();
 }
 
 double CameraND::get_field_of_view() const {
@@ -228,6 +380,7 @@ double CameraND::get_field_of_view() const {
 
 void CameraND::set_field_of_view(const double p_field_of_view_nd) {
 	_focal_length = Math::tan((Math_PI - p_field_of_view_nd) * 0.5);
+	_mark_redraw_needed();
 }
 
 double CameraND::get_orthographic_size() const {
@@ -236,6 +389,7 @@ double CameraND::get_orthographic_size() const {
 
 void CameraND::set_orthographic_size(const double p_orthographic_size) {
 	_orthographic_size = p_orthographic_size;
+	_mark_redraw_needed();
 }
 
 double CameraND::get_clip_near() const {
@@ -244,6 +398,7 @@ double CameraND::get_clip_near() const {
 
 void CameraND::set_clip_near(const double p_clip_near) {
 	_clip_near = p_clip_near;
+	_mark_redraw_needed();
 }
 
 double CameraND::get_clip_far() const {
@@ -252,6 +407,7 @@ double CameraND::get_clip_far() const {
 
 void CameraND::set_clip_far(const double p_clip_far) {
 	_clip_far = p_clip_far;
+	_mark_redraw_needed();
 }
 
 CameraND::PerpFadeMode CameraND::get_perp_fade_mode() const {
@@ -260,6 +416,7 @@ CameraND::PerpFadeMode CameraND::get_perp_fade_mode() const {
 
 void CameraND::set_perp_fade_mode(const PerpFadeMode p_perp_fade_mode) {
 	_perp_fade_mode = p_perp_fade_mode;
+	_mark_redraw_needed();
 	notify_property_list_changed();
 }
 
@@ -269,6 +426,7 @@ double CameraND::get_perp_fade_distance() const {
 
 void CameraND::set_perp_fade_distance(const double p_perp_fade_distance) {
 	_perp_fade_distance = p_perp_fade_distance;
+	_mark_redraw_needed();
 }
 
 double CameraND::get_perp_fade_slope() const {
@@ -277,6 +435,7 @@ double CameraND::get_perp_fade_slope() const {
 
 void CameraND::set_perp_fade_slope(const double p_perp_fade_slope) {
 	_perp_fade_slope = p_perp_fade_slope;
+	_mark_redraw_needed();
 }
 
 void CameraND::_bind_methods() {
@@ -292,6 +451,8 @@ void CameraND::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("viewport_to_world_ray_direction", "viewport_position"), &CameraND::viewport_to_world_ray_direction);
 	ClassDB::bind_method(D_METHOD("world_to_viewport_local_normal", "local_position", "force_orthographic"), &CameraND::world_to_viewport_local_normal, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("world_to_viewport", "global_position"), &CameraND::world_to_viewport);
+	ClassDB::bind_method(D_METHOD("project_many", "local_vertices_flat", "stride", "force_orthographic"), &CameraND::project_many, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("project_many_dict", "local_vertices_flat", "stride", "force_orthographic"), &CameraND::project_many_dict, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_rendering_engine_name"), &CameraND::get_rendering_engine_name);
 	ClassDB::bind_method(D_METHOD("set_rendering_engine_name", "rendering_engine_name"), &CameraND::set_rendering_engine_name);
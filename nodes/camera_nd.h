@@ -62,7 +62,20 @@ public:
 	VectorN viewport_to_world_ray_origin(const Vector2 &p_viewport_position) const;
 	VectorN viewport_to_world_ray_direction(const Vector2 &p_viewport_position) const;
 	Vector2 world_to_viewport_local_normal(const VectorN &p_local_position, const bool p_force_orthographic = false) const;
+	Vector2 world_to_viewport_local_normal_ptr(const double *p_local_position, const int64_t p_dimension, const bool p_force_orthographic = false) const; // Internal use only, do not expose.
 	Vector2 world_to_viewport(const VectorN &p_global_position) const;
+	// Projects many local vertices stored contiguously with the given stride, like world_to_viewport_local_normal,
+	// then applies r = projected * p_scale + p_offset. Optionally outputs the distance of each vertex from the
+	// camera, and the components beyond XYZ of each vertex, which are what the fade modes are based on.
+	// project_many_dict exposes those outputs to scripts, keyed by name in the returned Dictionary.
+	PackedVector2Array project_many(const PackedFloat64Array &p_local_vertices_flat, const int p_stride, const bool p_force_orthographic = false) const;
+	Dictionary project_many_dict(const PackedFloat64Array &p_local_vertices_flat, const int p_stride, const bool p_force_orthographic = false) const;
+	void project_many_ptr(const double *p_local_vertices, const int64_t p_vertex_count, const int p_stride, const bool p_force_orthographic, const Vector2 &p_scale, const Vector2 &p_offset, Vector2 *r_projected, double *r_distances = nullptr, double *r_perp_components = nullptr) const; // Internal use only, do not expose.
+
+	// Culling helpers for the rendering server. The half extents are the largest visible values of
+	// world_to_viewport_local_normal on each axis, and the rect is in this camera's local space.
+	Vector2 get_view_half_extents(const Vector2 &p_viewport_size) const; // Internal use only, do not expose.
+	bool is_local_rect_outside_view(const Ref<RectND> &p_local_rect, const Vector2 &p_view_half_extents) const; // Internal use only, do not expose.
 
 	String get_rendering_engine_name() const;
 	void set_rendering_engine_name(const String &p_rendering_engine_name);
@@ -1,5 +1,7 @@
 #include "node_nd.h"
 
+#include "../render/rendering_server_nd.h"
+
 // Transform getters and setters.
 
 Ref<TransformND> NodeND::get_transform() const {
@@ -7,7 +9,11 @@ Ref<TransformND> NodeND::get_transform() const {
 }
 
 void NodeND::set_transform(const Ref<TransformND> &p_transform) {
+	ERR_FAIL_COND(p_transform.is_null());
 	_transform = p_transform;
+	_transform->mark_as_node_transform();
+	// A different TransformND object may have any version, so the caches can't rely on it.
+	_local_transform_changed();
 	if (_rotation_euler.is_valid()) {
 		_rotation_euler->set_from_decomposed_simple_rotations_from_transform(_transform);
 		notify_property_list_changed();
@@ -20,6 +26,7 @@ Ref<BasisND> NodeND::get_basis() const {
 
 void NodeND::set_basis(const Ref<BasisND> &p_basis) {
 	_transform->set_basis(p_basis);
+	_local_transform_changed();
 	if (_rotation_euler.is_valid()) {
 		_rotation_euler->set_from_decomposed_simple_rotations_from_basis(p_basis);
 		notify_property_list_changed();
@@ -32,6 +39,7 @@ Vector<VectorN> NodeND::get_all_basis_columns() const {
 
 void NodeND::set_all_basis_columns(const Vector<VectorN> &p_columns) {
 	_transform->set_all_basis_columns(p_columns);
+	_local_transform_changed();
 	if (_rotation_euler.is_valid()) {
 		_rotation_euler->set_from_decomposed_simple_rotations(p_columns);
 		notify_property_list_changed();
@@ -44,6 +52,7 @@ TypedArray<VectorN> NodeND::get_all_basis_columns_bind() const {
 
 void NodeND::set_all_basis_columns_bind(const TypedArray<VectorN> &p_columns) {
 	_transform->set_all_basis_columns_bind(p_columns);
+	_local_transform_changed();
 	if (_rotation_euler.is_valid()) {
 		_rotation_euler->set_from_decomposed_simple_rotations(_transform->get_all_basis_columns());
 		notify_property_list_changed();
@@ -56,6 +65,7 @@ VectorN NodeND::get_basis_flat_array() const {
 
 void NodeND::set_basis_flat_array(const VectorN &p_array) {
 	_transform->set_basis_flat_array(p_array);
+	_local_transform_changed();
 	if (_rotation_euler.is_valid()) {
 		_rotation_euler->set_from_decomposed_simple_rotations(_transform->get_all_basis_columns());
 		notify_property_list_changed();
@@ -68,6 +78,7 @@ VectorN NodeND::get_position() const {
 
 void NodeND::set_position(const VectorN &p_position) {
 	_transform->set_origin(p_position);
+	_local_transform_changed();
 }
 
 VectorN NodeND::get_scale_abs() const {
@@ -76,6 +87,7 @@ VectorN NodeND::get_scale_abs() const {
 
 void NodeND::set_scale_abs(const VectorN &p_scale) {
 	_transform->set_scale_abs(p_scale);
+	_local_transform_changed();
 }
 
 int NodeND::get_euler_rotation_count() const {
@@ -114,6 +126,7 @@ void NodeND::set_euler_rotation_data(const PackedFloat64Array &p_data) {
 	_rotation_euler->set_all_rotation_data(p_data);
 	if (p_data.size() > 0) {
 		_rotation_euler->set_rotation_of_transform(_transform);
+		_local_transform_changed();
 	}
 	notify_property_list_changed();
 }
@@ -125,6 +138,7 @@ Ref<EulerND> NodeND::get_rotation_euler() const {
 void NodeND::set_rotation_euler(const Ref<EulerND> &p_euler) {
 	_rotation_euler = p_euler;
 	_rotation_euler->set_rotation_of_transform(_transform);
+	_local_transform_changed();
 	notify_property_list_changed();
 }
 
@@ -136,19 +150,111 @@ void NodeND::_update_transform_from_euler() {
 		return;
 	}
 	_rotation_euler->set_rotation_of_transform(_transform);
+	_local_transform_changed();
+}
+
+void NodeND::_mark_redraw_needed() const {
+	// Nodes outside of the tree are not rendered, so changing them does not need a redraw.
+	if (is_inside_tree()) {
+		RenderingServerND::mark_redraw_needed();
+	}
 }
 
 // Global transform getters and setters.
 
-Ref<TransformND> NodeND::get_global_transform() const {
-	const NodeND *node_nd_parent = Object::cast_to<NodeND>(get_parent());
-	if (node_nd_parent) {
-		return node_nd_parent->get_global_transform()->compose_square(_transform);
-	} else {
-		return _transform;
+void NodeND::_local_transform_changed() {
+	_mark_global_caches_dirty();
+	_mark_redraw_needed();
+}
+
+void NodeND::_mark_global_caches_dirty() {
+	bool was_any_clean = false;
+	for (int i = 0; i < GLOBAL_CACHE_MAX; i++) {
+		was_any_clean = was_any_clean || !_global_caches[i].is_dirty;
+		_global_caches[i].is_dirty = true;
+	}
+	// If every cache was already dirty, so are the caches of all descendants.
+	if (!was_any_clean) {
+		return;
+	}
+	const int child_count = get_child_count(true);
+	for (int i = 0; i < child_count; i++) {
+		NodeND *child_nd = Object::cast_to<NodeND>(get_child(i, true));
+		if (child_nd != nullptr) {
+			child_nd->_mark_global_caches_dirty();
+		}
 	}
 }
 
+const NodeND::GlobalCache &NodeND::_get_updated_global_cache(const GlobalCacheKind p_kind) const {
+	GlobalCache &cache = _global_caches[p_kind];
+	const uint64_t local_version = _transform->get_version();
+	const uint64_t shared_change_count = TransformND::get_shared_change_count();
+	if (!cache.is_dirty && cache.local_version == local_version && cache.shared_change_count == shared_change_count) {
+		return cache;
+	}
+	// Either the caches were marked dirty, or a node transform was modified in place through a reference
+	// from get_transform(), which could be any ancestor's, so walk up the tree and compare versions.
+	const NodeND *node_nd_parent = Object::cast_to<NodeND>(get_parent());
+	const GlobalCache *parent_cache = node_nd_parent ? &node_nd_parent->_get_updated_global_cache(p_kind) : nullptr;
+	const uint64_t parent_version = parent_cache ? parent_cache->version : 0;
+	cache.shared_change_count = shared_change_count;
+	if (!cache.is_dirty && cache.local_version == local_version && cache.parent_version == parent_version) {
+		return cache;
+	}
+	if (p_kind != GLOBAL_CACHE_BASIS && cache.transform.is_null()) {
+		cache.transform.instantiate();
+	}
+	switch (p_kind) {
+		case GLOBAL_CACHE_SQUARE: {
+			if (parent_cache) {
+				parent_cache->transform->compose_square_into(_transform, cache.transform);
+			} else {
+				_transform->copy_into(cache.transform);
+			}
+		} break;
+		case GLOBAL_CACHE_EXPAND: {
+			if (parent_cache) {
+				cache.transform = parent_cache->transform->compose_expand(_transform);
+			} else {
+				_transform->copy_into(cache.transform);
+			}
+		} break;
+		case GLOBAL_CACHE_SHRINK: {
+			if (parent_cache) {
+				cache.transform = parent_cache->transform->compose_shrink(_transform);
+			} else {
+				_transform->copy_into(cache.transform);
+			}
+		} break;
+		case GLOBAL_CACHE_BASIS: {
+			const Ref<BasisND> self_basis = _transform->get_basis();
+			if (parent_cache) {
+				cache.basis = parent_cache->basis->compose_square(self_basis);
+			} else {
+				cache.basis = self_basis;
+			}
+		} break;
+		case GLOBAL_CACHE_MAX: {
+			ERR_FAIL_V_MSG(cache, "NodeND: Invalid global cache kind.");
+		} break;
+	}
+	cache.local_version = local_version;
+	cache.parent_version = parent_version;
+	cache.version++;
+	cache.is_dirty = false;
+	return cache;
+}
+
+Ref<TransformND> NodeND::get_global_transform() const {
+	// Return a copy, callers are allowed to modify the returned transform.
+	return _get_updated_global_cache(GLOBAL_CACHE_SQUARE).transform->duplicate();
+}
+
+void NodeND::get_global_transform_into(const Ref<TransformND> &r_global_transform) const {
+	_get_updated_global_cache(GLOBAL_CACHE_SQUARE).transform->copy_into(r_global_transform);
+}
+
 void NodeND::set_global_transform(const Ref<TransformND> &p_transform) {
 	NodeND *node_nd_parent = Object::cast_to<NodeND>(get_parent());
 	if (node_nd_parent) {
@@ -161,13 +267,7 @@ void NodeND::set_global_transform(const Ref<TransformND> &p_transform) {
 }
 
 Ref<BasisND> NodeND::get_global_basis() const {
-	const Ref<BasisND> self_basis = _transform->get_basis();
-	const NodeND *node_nd_parent = Object::cast_to<NodeND>(get_parent());
-	if (node_nd_parent) {
-		return node_nd_parent->get_global_basis()->compose_square(self_basis);
-	} else {
-		return self_basis;
-	}
+	return _get_updated_global_cache(GLOBAL_CACHE_BASIS).basis->duplicate();
 }
 
 void NodeND::set_global_basis(const Ref<BasisND> &p_basis) {
@@ -183,21 +283,11 @@ void NodeND::set_global_basis(const Ref<BasisND> &p_basis) {
 }
 
 Ref<TransformND> NodeND::get_global_transform_expand() const {
-	NodeND *node_nd_parent = Object::cast_to<NodeND>(get_parent());
-	if (node_nd_parent) {
-		return node_nd_parent->get_global_transform_expand()->compose_expand(_transform);
-	} else {
-		return _transform;
-	}
+	return _get_updated_global_cache(GLOBAL_CACHE_EXPAND).transform->duplicate();
 }
 
 Ref<TransformND> NodeND::get_global_transform_shrink() const {
-	NodeND *node_nd_parent = Object::cast_to<NodeND>(get_parent());
-	if (node_nd_parent) {
-		return node_nd_parent->get_global_transform_shrink()->compose_shrink(_transform);
-	} else {
-		return _transform;
-	}
+	return _get_updated_global_cache(GLOBAL_CACHE_SHRINK).transform->duplicate();
 }
 
 VectorN NodeND::get_global_position() const {
@@ -231,6 +321,7 @@ int NodeND::get_dimension() const {
 void NodeND::set_dimension(const int p_dimension) {
 	ERR_FAIL_COND_MSG(p_dimension < 0, "NodeND: Dimension cannot be negative.");
 	_transform->set_dimension(p_dimension);
+	_local_transform_changed();
 	emit_signal("dimension_changed");
 }
 
@@ -240,6 +331,7 @@ int NodeND::get_input_dimension() const {
 
 void NodeND::set_input_dimension(const int p_input_dimension) {
 	_transform->set_basis_column_count(p_input_dimension);
+	_local_transform_changed();
 	emit_signal("dimension_changed");
 }
 
@@ -249,6 +341,7 @@ int NodeND::get_output_dimension() const {
 
 void NodeND::set_output_dimension(const int p_output_dimension) {
 	_transform->set_origin_dimension(p_output_dimension);
+	_local_transform_changed();
 	emit_signal("dimension_changed");
 }
 
@@ -270,7 +363,14 @@ bool NodeND::is_visible_in_tree() const {
 }
 
 void NodeND::set_visible(const bool p_visible) {
+	if (_is_visible == p_visible) {
+		return;
+	}
 	_is_visible = p_visible;
+	if (is_inside_tree()) {
+		propagate_notification(NOTIFICATION_VISIBILITY_CHANGED);
+		RenderingServerND::mark_redraw_needed();
+	}
 }
 
 // Rect bounds.
@@ -296,6 +396,16 @@ Ref<RectND> NodeND::get_rect_bounds_recursive(const Ref<TransformND> &p_to_targe
 	return bounds;
 }
 
+void NodeND::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_PARENTED:
+		case NOTIFICATION_UNPARENTED: {
+			_mark_global_caches_dirty();
+			RenderingServerND::mark_redraw_needed();
+		} break;
+	}
+}
+
 void NodeND::_bind_methods() {
 	// Transform getters and setters.
 	ClassDB::bind_method(D_METHOD("get_transform"), &NodeND::get_transform);
@@ -357,6 +467,8 @@ void NodeND::_bind_methods() {
 	BIND_ENUM_CONSTANT(DIMENSION_MODE_SQUARE);
 	BIND_ENUM_CONSTANT(DIMENSION_MODE_NON_SQUARE);
 
+	BIND_CONSTANT(NOTIFICATION_VISIBILITY_CHANGED);
+
 	ADD_SIGNAL(MethodInfo("dimension_changed"));
 }
 
@@ -439,4 +551,5 @@ void NodeND::_validate_property(PropertyInfo &p_property) const {
 
 NodeND::NodeND() {
 	_transform.instantiate();
+	_transform->mark_as_node_transform();
 }
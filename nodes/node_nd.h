@@ -21,16 +21,51 @@ public:
 		DIMENSION_MODE_NON_SQUARE,
 	};
 
+	enum {
+		// Sent to this node and all descendants when the visibility of this node changes while inside the tree.
+		NOTIFICATION_VISIBILITY_CHANGED = 43,
+	};
+
 private:
+	enum GlobalCacheKind {
+		GLOBAL_CACHE_SQUARE,
+		GLOBAL_CACHE_EXPAND,
+		GLOBAL_CACHE_SHRINK,
+		GLOBAL_CACHE_BASIS,
+		GLOBAL_CACHE_MAX,
+	};
+
+	// Cached global transform or basis, recomputed only when this node's local transform
+	// or the matching cache of the parent has changed since it was last computed.
+	// Changes made through NodeND are pushed down by marking the caches of all descendants dirty,
+	// so a clean cache is returned without visiting the ancestors, unless a node transform was
+	// modified in place since (see TransformND::get_shared_change_count). A dirty cache is never
+	// below a clean one, which lets the push stop at subtrees that are already dirty.
+	struct GlobalCache {
+		Ref<TransformND> transform;
+		Ref<BasisND> basis;
+		uint64_t local_version = 0;
+		uint64_t parent_version = 0;
+		uint64_t shared_change_count = 0;
+		uint64_t version = 0;
+		bool is_dirty = true;
+	};
+
 	Ref<EulerND> _rotation_euler;
 	Ref<TransformND> _transform;
+	mutable GlobalCache _global_caches[GLOBAL_CACHE_MAX];
 	DimensionMode _dimension_mode = DIMENSION_MODE_SQUARE;
 	bool _is_visible = true;
 
 	void _update_transform_from_euler();
+	void _local_transform_changed();
+	void _mark_global_caches_dirty();
+	const GlobalCache &_get_updated_global_cache(const GlobalCacheKind p_kind) const;
 
 protected:
 	static void _bind_methods();
+	void _notification(int p_what);
+	void _mark_redraw_needed() const;
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
 	void _get_property_list(List<PropertyInfo> *p_list) const;
@@ -63,6 +98,7 @@ public:
 
 	// Global transform getters and setters.
 	Ref<TransformND> get_global_transform() const;
+	void get_global_transform_into(const Ref<TransformND> &r_global_transform) const; // Internal use only, do not expose.
 	void set_global_transform(const Ref<TransformND> &p_transform);
 	Ref<BasisND> get_global_basis() const;
 	void set_global_basis(const Ref<BasisND> &p_basis);
@@ -0,0 +1,32 @@
+#include "parallel_chunks_nd.h"
+
+#if GDEXTENSION
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#elif GODOT_MODULE
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#endif
+
+int64_t ParallelChunksND::get_chunk_count(const int64_t p_item_count, const int64_t p_min_items_per_chunk) {
+	if (p_item_count <= 0) {
+		return 0;
+	}
+	const int64_t max_chunks_by_items = MAX((int64_t)1, p_item_count / MAX(p_min_items_per_chunk, (int64_t)1));
+	// A few chunks per thread, so that chunks with more expensive items don't leave other threads idle.
+	const int64_t max_chunks_by_threads = MAX((int64_t)1, (int64_t)OS::get_singleton()->get_processor_count() * 4);
+	return MIN(max_chunks_by_items, max_chunks_by_threads);
+}
+
+void ParallelChunksND::run_chunks(void (*p_function)(void *, uint32_t), void *p_userdata, const int64_t p_chunk_count, const String &p_description) {
+	if (p_chunk_count <= 0) {
+		return;
+	}
+	if (p_chunk_count == 1) {
+		p_function(p_userdata, 0);
+		return;
+	}
+	WorkerThreadPool *thread_pool = WorkerThreadPool::get_singleton();
+	const int64_t group_id = thread_pool->add_native_group_task(p_function, p_userdata, p_chunk_count, -1, true, p_description);
+	thread_pool->wait_for_group_task_completion(group_id);
+}
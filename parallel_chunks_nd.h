@@ -0,0 +1,17 @@
+#pragma once
+
+#include "godot_nd_defines.h"
+
+// Internal helpers for running independent per-item work in parallel on Godot's WorkerThreadPool.
+// Items are split into contiguous chunks, so each chunk can reuse its own scratch buffers.
+// The function is called once per chunk index, and must only write to the items of its chunk.
+// With one chunk, the work runs on the calling thread without dispatching.
+class ParallelChunksND {
+public:
+	static int64_t get_chunk_count(const int64_t p_item_count, const int64_t p_min_items_per_chunk);
+	static _FORCE_INLINE_ void get_chunk_range(const int64_t p_item_count, const int64_t p_chunk_count, const uint32_t p_chunk, int64_t &r_begin, int64_t &r_end) {
+		r_begin = p_item_count * (int64_t)p_chunk / p_chunk_count;
+		r_end = p_item_count * ((int64_t)p_chunk + 1) / p_chunk_count;
+	}
+	static void run_chunks(void (*p_function)(void *, uint32_t), void *p_userdata, const int64_t p_chunk_count, const String &p_description);
+};
@@ -2,9 +2,11 @@
 
 #if GDEXTENSION
 #include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
 #elif GODOT_MODULE
 #include "core/config/engine.h"
 #include "core/core_bind.h"
+#include "core/io/resource_loader.h"
 #ifdef TOOLS_ENABLED
 #include "editor/plugins/editor_plugin.h"
 #include "editor/themes/editor_color_map.h"
@@ -35,6 +37,7 @@
 #include "model/mesh/wire/wire_mesh_nd.h"
 
 // Model.
+#include "model/mesh/binary_mesh_nd.h"
 #include "model/mesh/cell/array_cell_mesh_nd.h"
 #include "model/mesh/cell/box_cell_mesh_nd.h"
 #include "model/mesh/cell/cell_material_nd.h"
@@ -83,6 +86,8 @@ inline void remove_godot_singleton(const StringName &p_singleton_name) {
 	CoreBind::Engine::get_singleton()->unregister_singleton(p_singleton_name);
 }
 
+static Ref<ResourceFormatLoaderBinaryMeshND> binary_mesh_loader;
+
 void initialize_nd_module(ModuleInitializationLevel p_level) {
 	// Note: Classes MUST be registered in inheritance order.
 	// When the inheritance doesn't matter, dependency order is used, then alphabetical order.
@@ -125,6 +130,15 @@ void initialize_nd_module(ModuleInitializationLevel p_level) {
 		GDREGISTER_CLASS(OrthoplexWireMeshND);
 		GDREGISTER_CLASS(CellMaterialND);
 		GDREGISTER_CLASS(WireMaterialND);
+#if GDEXTENSION
+		GDREGISTER_CLASS(ResourceFormatLoaderBinaryMeshND);
+#endif // GDEXTENSION
+		binary_mesh_loader.instantiate();
+#if GDEXTENSION
+		ResourceLoader::get_singleton()->add_resource_format_loader(binary_mesh_loader);
+#elif GODOT_MODULE
+		ResourceLoader::add_resource_format_loader(binary_mesh_loader);
+#endif
 		// Depends on mesh.
 		GDREGISTER_CLASS(MarkerND);
 		// Render.
@@ -171,6 +185,12 @@ void initialize_nd_module(ModuleInitializationLevel p_level) {
 
 void uninitialize_nd_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SCENE) {
+#if GDEXTENSION
+		ResourceLoader::get_singleton()->remove_resource_format_loader(binary_mesh_loader);
+#elif GODOT_MODULE
+		ResourceLoader::remove_resource_format_loader(binary_mesh_loader);
+#endif
+		binary_mesh_loader.unref();
 		remove_godot_singleton("GeometryND");
 		remove_godot_singleton("RenderingServerND");
 		remove_godot_singleton("VectorND");
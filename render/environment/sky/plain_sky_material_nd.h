@@ -12,7 +12,10 @@ protected:
 
 public:
 	Color get_color() const { return _color; }
-	void set_color(const Color &p_color) { _color = p_color; }
+	void set_color(const Color &p_color) {
+		_color = p_color;
+		emit_changed();
+	}
 
 	PlainSkyMaterialND();
 };
@@ -18,5 +18,8 @@ protected:
 
 public:
 	real_t get_energy_multiplier() const { return _energy_multiplier; }
-	void set_energy_multiplier(const real_t p_energy_multiplier) { _energy_multiplier = p_energy_multiplier; }
+	void set_energy_multiplier(const real_t p_energy_multiplier) {
+		_energy_multiplier = p_energy_multiplier;
+		emit_changed();
+	}
 };
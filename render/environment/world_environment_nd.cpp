@@ -42,6 +42,24 @@ void WorldEnvironmentND::make_current() {
 	}
 }
 
+void WorldEnvironmentND::_sky_material_changed() {
+	if (is_current()) {
+		_mark_redraw_needed();
+	}
+}
+
+void WorldEnvironmentND::set_sky_material(const Ref<SkyMaterialND> &p_sky_material) {
+	const Callable sky_material_changed_callable = callable_mp(this, &WorldEnvironmentND::_sky_material_changed);
+	if (_sky_material.is_valid() && _sky_material->is_connected(StringName("changed"), sky_material_changed_callable)) {
+		_sky_material->disconnect(StringName("changed"), sky_material_changed_callable);
+	}
+	_sky_material = p_sky_material;
+	if (_sky_material.is_valid()) {
+		_sky_material->connect(StringName("changed"), sky_material_changed_callable);
+	}
+	_sky_material_changed();
+}
+
 void WorldEnvironmentND::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_current"), &WorldEnvironmentND::is_current);
 	ClassDB::bind_method(D_METHOD("set_current", "enabled"), &WorldEnvironmentND::set_current);
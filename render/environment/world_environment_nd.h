@@ -10,6 +10,8 @@ class WorldEnvironmentND : public NodeND {
 
 	bool _is_current = false;
 
+	void _sky_material_changed();
+
 protected:
 	static void _bind_methods();
 	void _notification(int p_what);
@@ -21,5 +23,5 @@ public:
 	void make_current();
 
 	Ref<SkyMaterialND> get_sky_material() const { return _sky_material; }
-	void set_sky_material(const Ref<SkyMaterialND> &p_sky_material) { _sky_material = p_sky_material; }
+	void set_sky_material(const Ref<SkyMaterialND> &p_sky_material);
 };
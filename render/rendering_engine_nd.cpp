@@ -1,45 +1,188 @@
 #include "rendering_engine_nd.h"
 
+#include "../parallel_chunks_nd.h"
+
 #include <algorithm>
-#include <tuple>
-#include <vector>
+
+void RenderingEngineND::_calculate_relative_transforms_chunk(void *p_userdata, uint32_t p_chunk) {
+	const RelativeTransformParams &params = *(const RelativeTransformParams *)p_userdata;
+	int64_t item_begin = 0;
+	int64_t item_end = 0;
+	ParallelChunksND::get_chunk_range(params.item_count, params.chunk_count, p_chunk, item_begin, item_end);
+	for (int64_t i = item_begin; i < item_end; i++) {
+		MeshRenderItem &item = params.items[i];
+		// The relative transform holds the global transform here, and is composed in place.
+		params.camera_inverse_transform->compose_square_into(item.relative_transform, item.relative_transform);
+		item.sort_key = item.relative_transform->get_origin_element(2);
+	}
+}
+
+void RenderingEngineND::_update_camera_inverse_transform() {
+	if (_camera_inverse_transform.is_null()) {
+		_camera_inverse_transform.instantiate();
+		_scratch_global_transform.instantiate();
+	}
+	_camera->get_global_transform_into(_scratch_global_transform);
+	_scratch_global_transform->inverse_into(_camera_inverse_transform);
+}
+
+void RenderingEngineND::cull_mesh_instances() {
+	ERR_FAIL_NULL(_camera);
+	ERR_FAIL_NULL(_viewport);
+	const Vector2 viewport_size = _viewport->call(StringName("get_size"));
+	const Vector2 view_half_extents = _camera->get_view_half_extents(viewport_size);
+	_update_camera_inverse_transform();
+	// Compact the surviving mesh instances to the front of the list in place, preserving their order.
+	// Swap instead of overwriting, so the relative transforms stay allocated for reuse in later frames.
+	const int64_t mesh_count = _render_items.size();
+	MeshRenderItem *render_items_ptrw = _render_items.ptrw();
+	int64_t kept_count = 0;
+	for (int64_t i = 0; i < mesh_count; i++) {
+		const MeshInstanceND *mesh_instance = render_items_ptrw[i].mesh_instance;
+		const Ref<MeshND> mesh = mesh_instance->get_mesh();
+		ERR_CONTINUE(mesh.is_null());
+		mesh_instance->get_global_transform_into(_scratch_global_transform);
+		_camera_inverse_transform->compose_square_into(_scratch_global_transform, _scratch_global_transform);
+		const Ref<RectND> local_bounds = _scratch_global_transform->xform_rect(mesh->get_rect_bounds());
+		if (_camera->is_local_rect_outside_view(local_bounds, view_half_extents)) {
+			continue;
+		}
+		if (kept_count != i) {
+			SWAP(render_items_ptrw[kept_count], render_items_ptrw[i]);
+		}
+		kept_count++;
+	}
+	_render_items.resize(kept_count);
+	_are_bound_arrays_dirty = true;
+}
+
+void RenderingEngineND::_prune_edge_color_cache() {
+	Vector<EdgeColorCacheKey> unused_keys;
+	for (const KeyValue<EdgeColorCacheKey, EdgeColorCacheEntry> &E : _edge_color_cache) {
+		if (E.value.last_used_frame + EDGE_COLOR_CACHE_MAX_UNUSED_FRAMES < _frame_number) {
+			unused_keys.push_back(E.key);
+		}
+	}
+	for (const EdgeColorCacheKey &key : unused_keys) {
+		_edge_color_cache.erase(key);
+	}
+}
+
+const PackedColorArray &RenderingEngineND::_get_edge_colors(const Ref<MeshND> &p_mesh, const Ref<MaterialND> &p_material) {
+	EdgeColorCacheKey key;
+	key.mesh_id = ObjectID(p_mesh->get_instance_id());
+	if (p_material.is_valid()) {
+		key.material_id = ObjectID(p_material->get_instance_id());
+	}
+	EdgeColorCacheEntry *entry = _edge_color_cache.getptr(key);
+	if (entry == nullptr) {
+		entry = &_edge_color_cache.insert(key, EdgeColorCacheEntry())->value;
+	}
+	entry->last_used_frame = _frame_number;
+	const uint64_t mesh_version = p_mesh->get_version();
+	const uint64_t material_version = p_material.is_valid() ? p_material->get_version() : 1;
+	// Script meshes can change their edges without bumping the version, so check the edge count too.
+	const int64_t edge_count = p_mesh->get_edge_indices().size() / 2;
+	if (entry->mesh_version == mesh_version && entry->material_version == material_version && entry->edge_colors.size() == edge_count) {
+		return entry->edge_colors;
+	}
+	entry->mesh_version = mesh_version;
+	entry->material_version = material_version;
+	entry->edge_colors.clear();
+	Color fallback_color = Color(1.0f, 1.0f, 1.0f);
+	if (p_material.is_valid()) {
+		p_material->get_albedo_colors_of_edges(p_mesh, entry->edge_colors);
+		fallback_color = p_material->get_albedo_color();
+	}
+	// Without a material, use white. If the material can't color all edges, use its single color for the rest.
+	const int64_t colored_count = MIN(entry->edge_colors.size(), edge_count);
+	entry->edge_colors.resize(edge_count);
+	Color *edge_colors_ptrw = entry->edge_colors.ptrw();
+	for (int64_t i = colored_count; i < edge_count; i++) {
+		edge_colors_ptrw[i] = fallback_color;
+	}
+	return entry->edge_colors;
+}
 
 void RenderingEngineND::calculate_relative_transforms() {
-	const int mesh_count = _mesh_instance_object_ids.size();
-	_mesh_relative_transforms.resize(mesh_count);
-	const Ref<TransformND> camera_inverse_transform = _camera->get_global_transform()->inverse();
-	for (int64_t i = 0; i < _mesh_instance_object_ids.size(); i++) {
-		const ObjectID mesh_instance_object_id = (ObjectID)_mesh_instance_object_ids[i];
-		const MeshInstanceND *mesh_instance = Object::cast_to<const MeshInstanceND>(ObjectDB::get_instance(mesh_instance_object_id));
-		const Ref<TransformND> relative_transform = camera_inverse_transform->compose_square(mesh_instance->get_global_transform());
-		_mesh_relative_transforms[i] = relative_transform;
+	_frame_number++;
+	if (_frame_number % EDGE_COLOR_CACHE_MAX_UNUSED_FRAMES == 0) {
+		_prune_edge_color_cache();
 	}
+	// Reuse the transforms from the previous frame, so that a steady scene does not allocate here.
+	_update_camera_inverse_transform();
+	const int64_t mesh_count = _render_items.size();
+	MeshRenderItem *render_items_ptrw = _render_items.ptrw();
+	// Global transform caches and materials are shared between nodes and updated lazily, so read them on this thread.
+	for (int64_t i = 0; i < mesh_count; i++) {
+		MeshRenderItem &item = render_items_ptrw[i];
+		if (item.relative_transform.is_null()) {
+			item.relative_transform.instantiate();
+		}
+		item.mesh_instance->get_global_transform_into(item.relative_transform);
+		item.material = item.mesh_instance->get_active_material();
+	}
+	// Each item only writes to its own relative transform, so composing can run in parallel.
+	RelativeTransformParams params;
+	params.camera_inverse_transform = _camera_inverse_transform.ptr();
+	params.items = render_items_ptrw;
+	params.item_count = mesh_count;
+	params.chunk_count = ParallelChunksND::get_chunk_count(mesh_count, 256);
+	ParallelChunksND::run_chunks(&RenderingEngineND::_calculate_relative_transforms_chunk, &params, params.chunk_count, "RenderingEngineND: Calculate relative transforms");
 	_sort_meshes_by_relative_z();
+	_are_bound_arrays_dirty = true;
 }
 
 void RenderingEngineND::_sort_meshes_by_relative_z() {
-	// Can't use Godot's types to do this operation easily, so we'll use the standard library instead.
-	std::vector<std::tuple<Variant, Variant>> combined;
-	const int64_t mesh_count = _mesh_instance_object_ids.size();
-	combined.reserve(mesh_count);
-	for (int64_t i = 0; i < mesh_count; ++i) {
-		combined.emplace_back(_mesh_instance_object_ids[i], _mesh_relative_transforms[i]);
-	}
-	// Sort the vector of tuples based on the Z position.
-	std::sort(combined.begin(), combined.end(), [](const auto &a, const auto &b) {
-		const Ref<TransformND> a_transform = std::get<1>(a);
-		const Ref<TransformND> b_transform = std::get<1>(b);
-		const VectorN a_origin = a_transform->get_origin();
-		const VectorN b_origin = b_transform->get_origin();
-		const double a_z = a_origin.size() > 2 ? a_origin[2] : 0.0;
-		const double b_z = b_origin.size() > 2 ? b_origin[2] : 0.0;
-		return a_z < b_z;
-	});
-	// Unpack the sorted tuples back into the original arrays
-	for (size_t i = 0; i < combined.size(); ++i) {
-		_mesh_instance_object_ids.set(i, std::get<0>(combined[i]));
-		_mesh_relative_transforms[i] = std::get<1>(combined[i]);
+	// Sort small POD entries by the precomputed key, then apply the permutation to the render list once.
+	const int64_t mesh_count = _render_items.size();
+	_sort_entries.resize(mesh_count);
+	SortEntry *sort_entries_ptrw = _sort_entries.ptrw();
+	const MeshRenderItem *render_items_ptr = _render_items.ptr();
+	bool is_sorted = true;
+	for (int64_t i = 0; i < mesh_count; i++) {
+		sort_entries_ptrw[i] = SortEntry{ render_items_ptr[i].sort_key, i };
+		if (i > 0 && sort_entries_ptrw[i] < sort_entries_ptrw[i - 1]) {
+			is_sorted = false;
+		}
+	}
+	if (is_sorted) {
+		return;
+	}
+	std::sort(sort_entries_ptrw, sort_entries_ptrw + mesh_count);
+	_sorted_render_items.resize(mesh_count);
+	MeshRenderItem *sorted_ptrw = _sorted_render_items.ptrw();
+	MeshRenderItem *render_items_ptrw = _render_items.ptrw();
+	for (int64_t i = 0; i < mesh_count; i++) {
+		SWAP(sorted_ptrw[i], render_items_ptrw[sort_entries_ptrw[i].index]);
+	}
+	SWAP(_render_items, _sorted_render_items);
+}
+
+void RenderingEngineND::_update_bound_arrays() const {
+	if (!_are_bound_arrays_dirty) {
+		return;
 	}
+	const int64_t mesh_count = _render_items.size();
+	_mesh_instance_object_ids.resize(mesh_count);
+	_mesh_relative_transforms.resize(mesh_count);
+	for (int64_t i = 0; i < mesh_count; i++) {
+		const MeshRenderItem &item = _render_items[i];
+		_mesh_instance_object_ids.set(i, (int64_t)item.mesh_instance_object_id);
+		// The render items reuse their transforms every frame, so scripts get copies they can keep.
+		_mesh_relative_transforms[i] = item.relative_transform->duplicate();
+	}
+	_are_bound_arrays_dirty = false;
+}
+
+PackedInt64Array RenderingEngineND::get_mesh_instance_object_ids() const {
+	_update_bound_arrays();
+	return _mesh_instance_object_ids;
+}
+
+TypedArray<TransformND> RenderingEngineND::get_mesh_relative_transforms() const {
+	_update_bound_arrays();
+	return _mesh_relative_transforms;
 }
 
 void RenderingEngineND::set_viewport(Viewport *p_viewport) {
@@ -50,8 +193,23 @@ void RenderingEngineND::set_camera(CameraND *p_camera) {
 	_camera = p_camera;
 }
 
-void RenderingEngineND::set_mesh_instance_object_ids(PackedInt64Array p_mesh_instance_object_ids) {
-	_mesh_instance_object_ids = p_mesh_instance_object_ids;
+void RenderingEngineND::set_mesh_instance_object_ids(const PackedInt64Array &p_mesh_instance_object_ids) {
+	// Resolve each ObjectID once per frame here, later stages use the pointers directly.
+	// Existing entries are overwritten in place, so their relative transforms can be reused.
+	const int64_t id_count = p_mesh_instance_object_ids.size();
+	_render_items.resize(id_count);
+	MeshRenderItem *render_items_ptrw = _render_items.ptrw();
+	int64_t item_count = 0;
+	for (int64_t i = 0; i < id_count; i++) {
+		const ObjectID mesh_instance_object_id = (ObjectID)p_mesh_instance_object_ids[i];
+		MeshInstanceND *mesh_instance = Object::cast_to<MeshInstanceND>(ObjectDB::get_instance(mesh_instance_object_id));
+		ERR_CONTINUE(mesh_instance == nullptr);
+		render_items_ptrw[item_count].mesh_instance = mesh_instance;
+		render_items_ptrw[item_count].mesh_instance_object_id = mesh_instance_object_id;
+		item_count++;
+	}
+	_render_items.resize(item_count);
+	_are_bound_arrays_dirty = true;
 }
 
 String RenderingEngineND::get_friendly_name() const {
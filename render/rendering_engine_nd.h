@@ -6,9 +6,11 @@
 #if GDEXTENSION
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
 #elif GODOT_MODULE
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/viewport.h"
 #endif
@@ -16,6 +18,28 @@
 class RenderingEngineND : public RefCounted {
 	GDCLASS(RenderingEngineND, RefCounted);
 
+public:
+	// One entry of the internal render list, so C++ engines don't need Variant conversions or ObjectDB lookups.
+	struct MeshRenderItem {
+		// Only valid during the frame, use the ObjectID after that.
+		MeshInstanceND *mesh_instance = nullptr;
+		ObjectID mesh_instance_object_id;
+		Ref<TransformND> relative_transform;
+		Ref<MaterialND> material;
+		// Sorted in ascending order, which is the Z position relative to the camera, so far meshes come first.
+		double sort_key = 0.0;
+	};
+
+private:
+	struct SortEntry {
+		double key;
+		int64_t index;
+		bool operator<(const SortEntry &p_other) const {
+			// Compare the index too, so that the order is deterministic for equal keys.
+			return key < p_other.key || (key == p_other.key && index < p_other.index);
+		}
+	};
+
 #if GDEXTENSION
 	TypedArray<Viewport> _setup_viewports;
 #elif GODOT_MODULE
@@ -25,15 +49,65 @@ class RenderingEngineND : public RefCounted {
 	Viewport *_viewport = nullptr;
 	CameraND *_camera = nullptr;
 
-	PackedInt64Array _mesh_instance_object_ids;
-	TypedArray<TransformND> _mesh_relative_transforms;
+	Vector<MeshRenderItem> _render_items;
+	Vector<MeshRenderItem> _sorted_render_items;
+	Vector<SortEntry> _sort_entries;
+	Ref<TransformND> _camera_inverse_transform;
+	Ref<TransformND> _scratch_global_transform;
+
+	// Only built when requested from scripts, from the render list above.
+	mutable PackedInt64Array _mesh_instance_object_ids;
+	mutable TypedArray<TransformND> _mesh_relative_transforms;
+	mutable bool _are_bound_arrays_dirty = true;
+
+	// Edge colors of each (mesh, material) pair, only recomputed when the version of either changes.
+	// Keyed by both, since one mesh is often used with different material overrides, and vice versa.
+	struct EdgeColorCacheKey {
+		ObjectID mesh_id;
+		ObjectID material_id;
+		bool operator==(const EdgeColorCacheKey &p_other) const {
+			return mesh_id == p_other.mesh_id && material_id == p_other.material_id;
+		}
+	};
+	struct EdgeColorCacheKeyHasher {
+		static _FORCE_INLINE_ uint32_t hash(const EdgeColorCacheKey &p_key) {
+			return hash_fmix32(hash_murmur3_one_64((uint64_t)p_key.material_id, hash_murmur3_one_64((uint64_t)p_key.mesh_id)));
+		}
+	};
+	struct EdgeColorCacheEntry {
+		PackedColorArray edge_colors;
+		uint64_t mesh_version = 0;
+		uint64_t material_version = 0;
+		uint64_t last_used_frame = 0;
+	};
+	// Entries unused for this many frames are removed, so freed or hidden meshes don't keep their colors forever.
+	static constexpr uint64_t EDGE_COLOR_CACHE_MAX_UNUSED_FRAMES = 120;
+	HashMap<EdgeColorCacheKey, EdgeColorCacheEntry, EdgeColorCacheKeyHasher> _edge_color_cache;
+	uint64_t _frame_number = 0;
+
+	void _prune_edge_color_cache();
+
+	struct RelativeTransformParams {
+		const TransformND *camera_inverse_transform = nullptr;
+		MeshRenderItem *items = nullptr;
+		int64_t item_count = 0;
+		int64_t chunk_count = 0;
+	};
+	static void _calculate_relative_transforms_chunk(void *p_userdata, uint32_t p_chunk);
 
 	void _sort_meshes_by_relative_z();
+	void _update_bound_arrays() const;
+	void _update_camera_inverse_transform();
 
 protected:
 	static void _bind_methods();
 
+	// Returns the colors of all edges of the mesh when drawn with the material, with one color per edge.
+	// Cached between frames, and not thread-safe, so call it on the rendering thread and share the result.
+	const PackedColorArray &_get_edge_colors(const Ref<MeshND> &p_mesh, const Ref<MaterialND> &p_material);
+
 public:
+	void cull_mesh_instances();
 	void calculate_relative_transforms();
 
 	Viewport *get_viewport() const { return _viewport; }
@@ -42,9 +116,10 @@ public:
 	CameraND *get_camera() const { return _camera; }
 	void set_camera(CameraND *p_camera); // Internal use only, do not expose.
 
-	PackedInt64Array get_mesh_instance_object_ids() const { return _mesh_instance_object_ids; }
-	void set_mesh_instance_object_ids(PackedInt64Array p_mesh_instance_object_ids); // Internal use only, do not expose.
-	TypedArray<TransformND> get_mesh_relative_transforms() const { return _mesh_relative_transforms; }
+	PackedInt64Array get_mesh_instance_object_ids() const;
+	void set_mesh_instance_object_ids(const PackedInt64Array &p_mesh_instance_object_ids); // Internal use only, do not expose.
+	TypedArray<TransformND> get_mesh_relative_transforms() const;
+	const Vector<MeshRenderItem> &get_render_items() const { return _render_items; } // Internal use only, do not expose.
 
 	void setup_for_viewport_if_needed(Viewport *p_for_viewport);
 	void cleanup_for_viewport_if_needed(Viewport *p_for_viewport);
@@ -45,22 +45,77 @@ RenderingServerND::~RenderingServerND() {
 	singleton = nullptr;
 }
 
-PackedInt64Array RenderingServerND::_get_visible_mesh_instance_object_ids() const {
-	PackedInt64Array visible_mesh_instance_object_ids;
-	for (int i = 0; i < _mesh_instances.size(); i++) {
-		MeshInstanceND *mesh_instance = (MeshInstanceND *)(Object *)_mesh_instances[i];
+void RenderingServerND::_add_visible_mesh_instance(MeshInstanceND *p_mesh_instance) {
+	if (_visible_mesh_instance_indices.has(p_mesh_instance)) {
+		return;
+	}
+	_visible_mesh_instance_indices.insert(p_mesh_instance, _visible_mesh_instances.size());
+	_visible_mesh_instances.append(p_mesh_instance);
+	_visible_mesh_instance_object_ids.append(p_mesh_instance->get_instance_id());
+}
+
+void RenderingServerND::_remove_visible_mesh_instance(MeshInstanceND *p_mesh_instance) {
+	const int64_t *index_ptr = _visible_mesh_instance_indices.getptr(p_mesh_instance);
+	if (index_ptr == nullptr) {
+		return;
+	}
+	// Swap with the last element, so removal does not shift the whole array.
+	const int64_t index = *index_ptr;
+	const int64_t last_index = _visible_mesh_instances.size() - 1;
+	_visible_mesh_instance_indices.erase(p_mesh_instance);
+	if (index != last_index) {
+		MeshInstanceND *last_mesh_instance = _visible_mesh_instances[last_index];
+		_visible_mesh_instances.set(index, last_mesh_instance);
+		_visible_mesh_instance_object_ids.set(index, _visible_mesh_instance_object_ids[last_index]);
+		_visible_mesh_instance_indices[last_mesh_instance] = index;
+	}
+	_visible_mesh_instances.resize(last_index);
+	_visible_mesh_instance_object_ids.resize(last_index);
+}
+
+void RenderingServerND::_update_visible_mesh_instances() {
+	if (_mesh_instances_to_update.is_empty()) {
+		return;
+	}
+	Vector<MeshInstanceND *> mesh_instances_to_update;
+	mesh_instances_to_update.resize(_mesh_instances_to_update.size());
+	int64_t index = 0;
+	for (MeshInstanceND *mesh_instance : _mesh_instances_to_update) {
+		mesh_instances_to_update.set(index, mesh_instance);
+		index++;
+	}
+	_mesh_instances_to_update.clear();
+	for (MeshInstanceND *mesh_instance : mesh_instances_to_update) {
 		CRASH_COND_MSG(mesh_instance == nullptr, "MeshInstanceND is null. This should never happen.");
-		if (mesh_instance->is_visible_in_tree()) {
-			Ref<MeshND> mesh = mesh_instance->get_mesh();
-			if (mesh.is_valid() && mesh->is_mesh_data_valid()) {
-				visible_mesh_instance_object_ids.append(mesh_instance->get_instance_id());
-			}
+		if (!mesh_instance->is_visible_in_tree()) {
+			_remove_visible_mesh_instance(mesh_instance);
+			continue;
+		}
+		Ref<MeshND> mesh = mesh_instance->get_mesh();
+		if (mesh.is_valid() && mesh->is_mesh_data_valid()) {
+			_add_visible_mesh_instance(mesh_instance);
+		} else {
+			// Invalid mesh data is checked again when the mesh emits changed after its data is modified.
+			_remove_visible_mesh_instance(mesh_instance);
 		}
 	}
-	return visible_mesh_instance_object_ids;
+}
+
+PackedInt64Array RenderingServerND::_get_visible_mesh_instance_object_ids() {
+	_update_visible_mesh_instances();
+	return _visible_mesh_instance_object_ids;
+}
+
+bool RenderingServerND::_is_redraw_pending() const {
+	// Queued mesh instances also count, since they are queued when their mesh or visibility changes.
+	return !_is_redraw_on_change_enabled || _is_redraw_needed || !_mesh_instances_to_update.is_empty();
 }
 
 void RenderingServerND::_render_frame() {
+	if (!_is_redraw_pending()) {
+		return;
+	}
+	_is_redraw_needed = false;
 	for (const KeyValue<Viewport *, Vector<CameraND *>> &E : _viewport_cameras) {
 		Viewport *viewport = E.key;
 		const Vector<CameraND *> &cameras = E.value;
@@ -99,12 +154,16 @@ void RenderingServerND::_render_frame() {
 		emit_signal("pre_render", camera0, viewport, rendering_engine);
 		PackedInt64Array visible_mesh_instance_object_ids = _get_visible_mesh_instance_object_ids();
 		rendering_engine->set_mesh_instance_object_ids(visible_mesh_instance_object_ids);
+		rendering_engine->cull_mesh_instances();
 		rendering_engine->calculate_relative_transforms();
 		rendering_engine->render_frame();
 	}
 }
 
 void RenderingServerND::_request_godot_redraw() {
+	if (!_is_redraw_pending()) {
+		return;
+	}
 	RenderingServer *rendering_server = RenderingServer::get_singleton();
 	ERR_FAIL_NULL(rendering_server);
 	for (const KeyValue<Viewport *, Vector<CameraND *>> &E : _viewport_cameras) {
@@ -141,6 +200,7 @@ void RenderingServerND::register_camera(CameraND *p_camera) {
 	Vector<CameraND *> cameras;
 	cameras.append(p_camera);
 	_viewport_cameras[viewport] = cameras;
+	_is_redraw_needed = true;
 	p_camera->make_current();
 	// Is this also the first time any CameraND has been registered? If so, connect to the RenderingServer's frame signal.
 	if (_are_render_frame_and_process_frame_connected) {
@@ -156,6 +216,7 @@ void RenderingServerND::register_camera(CameraND *p_camera) {
 	// There are a ton of things that will need a redraw, to the point that it is easier to just request a redraw
 	// every tick, rather than slow each tick down with a thousand calls to `_request_godot_redraw()` each tick.
 	// This will result in increased resource usage when idle, but more FPS when actively running, it's a tradeoff.
+	// Projects that are mostly idle can enable redraw on change, which skips ticks where nothing was changed.
 	godot_scene_tree->connect(StringName("process_frame"), callable_mp(this, &RenderingServerND::_request_godot_redraw));
 	_are_render_frame_and_process_frame_connected = true;
 }
@@ -171,6 +232,7 @@ void RenderingServerND::unregister_camera(CameraND *p_camera) {
 		p_camera->clear_current();
 	}
 	cameras.erase(p_camera);
+	_is_redraw_needed = true;
 	if (cameras.is_empty()) {
 		for (KeyValue<String, Ref<RenderingEngineND>> &E : _rendering_engines) {
 			if (E.value.is_valid()) {
@@ -209,6 +271,7 @@ void RenderingServerND::make_camera_current(CameraND *p_camera) {
 	Viewport *viewport = p_camera->get_viewport();
 	Vector<CameraND *> &cameras = _viewport_cameras[viewport];
 	ERR_FAIL_COND(!cameras.has(p_camera));
+	_is_redraw_needed = true;
 	CameraND *camera0 = cameras[0];
 	if (p_camera != camera0) {
 		if (camera0->is_current()) {
@@ -227,6 +290,7 @@ void RenderingServerND::clear_camera_current(CameraND *p_camera) {
 	Viewport *viewport = p_camera->get_viewport();
 	Vector<CameraND *> &cameras = _viewport_cameras[viewport];
 	ERR_FAIL_COND(!cameras.has(p_camera));
+	_is_redraw_needed = true;
 	if (p_camera == cameras[0] && cameras.size() > 1) {
 		cameras.remove_at(0);
 		cameras.append(p_camera);
@@ -267,6 +331,7 @@ void RenderingServerND::register_world_environment(WorldEnvironmentND *p_world_e
 	Vector<WorldEnvironmentND *> world_environments;
 	world_environments.append(p_world_environment);
 	_viewport_world_environments[viewport] = world_environments;
+	_is_redraw_needed = true;
 	p_world_environment->make_current();
 }
 
@@ -281,6 +346,7 @@ void RenderingServerND::unregister_world_environment(WorldEnvironmentND *p_world
 		p_world_environment->clear_current();
 	}
 	world_environments.erase(p_world_environment);
+	_is_redraw_needed = true;
 	if (world_environments.is_empty()) {
 		_viewport_world_environments.erase(viewport);
 	}
@@ -296,6 +362,7 @@ void RenderingServerND::make_world_environment_current(WorldEnvironmentND *p_wor
 	Viewport *viewport = p_world_environment->get_viewport();
 	Vector<WorldEnvironmentND *> &world_environments = _viewport_world_environments[viewport];
 	ERR_FAIL_COND(!world_environments.has(p_world_environment));
+	_is_redraw_needed = true;
 	WorldEnvironmentND *world_environment0 = world_environments[0];
 	if (p_world_environment != world_environment0) {
 		if (world_environment0->is_current()) {
@@ -314,6 +381,7 @@ void RenderingServerND::clear_world_environment_current(WorldEnvironmentND *p_wo
 	Viewport *viewport = p_world_environment->get_viewport();
 	Vector<WorldEnvironmentND *> &world_environments = _viewport_world_environments[viewport];
 	ERR_FAIL_COND(!world_environments.has(p_world_environment));
+	_is_redraw_needed = true;
 	if (p_world_environment == world_environments[0] && world_environments.size() > 1) {
 		world_environments.remove_at(0);
 		world_environments.append(p_world_environment);
@@ -363,13 +431,25 @@ WorldEnvironmentND *RenderingServerND::get_current_world_environment_for_camera(
 void RenderingServerND::register_mesh_instance(MeshInstanceND *p_mesh_instance) {
 	ERR_FAIL_NULL(p_mesh_instance);
 	ERR_FAIL_COND_MSG(_mesh_instances.has(p_mesh_instance), "MeshInstanceND is already registered.");
-	_mesh_instances.append(p_mesh_instance);
+	_mesh_instances.insert(p_mesh_instance);
+	_mesh_instances_to_update.insert(p_mesh_instance);
 }
 
 void RenderingServerND::unregister_mesh_instance(MeshInstanceND *p_mesh_instance) {
 	ERR_FAIL_NULL(p_mesh_instance);
 	ERR_FAIL_COND_MSG(!_mesh_instances.has(p_mesh_instance), "MeshInstanceND is not registered.");
 	_mesh_instances.erase(p_mesh_instance);
+	_mesh_instances_to_update.erase(p_mesh_instance);
+	_remove_visible_mesh_instance(p_mesh_instance);
+	_is_redraw_needed = true;
+}
+
+void RenderingServerND::update_mesh_instance_visibility(MeshInstanceND *p_mesh_instance) {
+	ERR_FAIL_NULL(p_mesh_instance);
+	if (!_mesh_instances.has(p_mesh_instance)) {
+		return; // Not in the tree, it will be checked when registered.
+	}
+	_mesh_instances_to_update.insert(p_mesh_instance);
 }
 
 void RenderingServerND::register_rendering_engine(const Ref<RenderingEngineND> &p_engine) {
@@ -378,10 +458,12 @@ void RenderingServerND::register_rendering_engine(const Ref<RenderingEngineND> &
 		WARN_PRINT("Rendering engine '" + friendly_name + "' already registered. The existing engine will be replaced.");
 	}
 	_rendering_engines[friendly_name] = p_engine;
+	_is_redraw_needed = true;
 }
 
 void RenderingServerND::unregister_rendering_engine(const String &p_friendly_name) {
 	_rendering_engines.erase(p_friendly_name);
+	_is_redraw_needed = true;
 }
 
 PackedStringArray RenderingServerND::get_rendering_engine_names() const {
@@ -411,6 +493,19 @@ Ref<RenderingEngineND> RenderingServerND::get_rendering_engine_from_name(const S
 	return _rendering_engines.begin()->value;
 }
 
+bool RenderingServerND::is_redraw_on_change_enabled() const {
+	return _is_redraw_on_change_enabled;
+}
+
+void RenderingServerND::set_redraw_on_change_enabled(const bool p_enabled) {
+	_is_redraw_on_change_enabled = p_enabled;
+	_is_redraw_needed = true;
+}
+
+void RenderingServerND::request_redraw() {
+	_is_redraw_needed = true;
+}
+
 RenderingServerND *RenderingServerND::singleton = nullptr;
 
 void RenderingServerND::_bind_methods() {
@@ -418,6 +513,11 @@ void RenderingServerND::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("register_rendering_engine", "engine"), &RenderingServerND::register_rendering_engine);
 	ClassDB::bind_method(D_METHOD("unregister_rendering_engine", "name"), &RenderingServerND::unregister_rendering_engine);
 	ClassDB::bind_method(D_METHOD("get_rendering_engine_names"), &RenderingServerND::get_rendering_engine_names);
+	ClassDB::bind_method(D_METHOD("is_redraw_on_change_enabled"), &RenderingServerND::is_redraw_on_change_enabled);
+	ClassDB::bind_method(D_METHOD("set_redraw_on_change_enabled", "enabled"), &RenderingServerND::set_redraw_on_change_enabled);
+	ClassDB::bind_method(D_METHOD("request_redraw"), &RenderingServerND::request_redraw);
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "redraw_on_change_enabled"), "set_redraw_on_change_enabled", "is_redraw_on_change_enabled");
 
 	ADD_SIGNAL(MethodInfo("pre_render", PropertyInfo(Variant::OBJECT, "camera", PROPERTY_HINT_RESOURCE_TYPE, "CameraND"), PropertyInfo(Variant::OBJECT, "viewport", PROPERTY_HINT_RESOURCE_TYPE, "Viewport"), PropertyInfo(Variant::OBJECT, "rendering_engine", PROPERTY_HINT_RESOURCE_TYPE, "RenderingEngineND")));
 }
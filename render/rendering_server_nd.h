@@ -4,7 +4,10 @@
 
 #if GDEXTENSION
 #include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
 #include <godot_cpp/templates/vector.hpp>
+#elif GODOT_MODULE
+#include "core/templates/hash_set.h"
 #endif
 
 class WorldEnvironmentND;
@@ -18,10 +21,25 @@ class RenderingServerND : public Object {
 	// For 3D, Godot has "World3D" which meshes are added to. Cameras in the same world can see the same meshes.
 	// For ND, we will use a simpler approach, just have one global array of meshes which all cameras can see.
 	// We could add a "WorldND" class in the future if we want to add this feature, but it's not necessary for now.
-	Vector<MeshInstanceND *> _mesh_instances;
+	HashSet<MeshInstanceND *> _mesh_instances;
+	// The visible set is maintained incrementally: mesh instances are queued for an update when they
+	// are registered or when their visibility or mesh changes, and only queued ones are checked per frame.
+	// The two arrays are parallel, and the HashMap stores the index of each visible mesh instance in them.
+	Vector<MeshInstanceND *> _visible_mesh_instances;
+	PackedInt64Array _visible_mesh_instance_object_ids;
+	HashMap<MeshInstanceND *, int64_t> _visible_mesh_instance_indices;
+	HashSet<MeshInstanceND *> _mesh_instances_to_update;
 
-	PackedInt64Array _get_visible_mesh_instance_object_ids() const;
+	void _add_visible_mesh_instance(MeshInstanceND *p_mesh_instance);
+	void _remove_visible_mesh_instance(MeshInstanceND *p_mesh_instance);
+	void _update_visible_mesh_instances();
+	PackedInt64Array _get_visible_mesh_instance_object_ids();
 	bool _are_render_frame_and_process_frame_connected = false;
+	// When redraw on change is enabled, frames are only rendered and redraws only requested when something
+	// that affects ND rendering has called request_redraw() since the last rendered frame.
+	bool _is_redraw_on_change_enabled = false;
+	bool _is_redraw_needed = true;
+	bool _is_redraw_pending() const;
 	void _render_frame();
 	void _request_godot_redraw();
 
@@ -45,12 +63,23 @@ public:
 
 	void register_mesh_instance(MeshInstanceND *p_mesh_instance);
 	void unregister_mesh_instance(MeshInstanceND *p_mesh_instance);
+	void update_mesh_instance_visibility(MeshInstanceND *p_mesh_instance); // Internal use only, do not expose.
 
 	void register_rendering_engine(const Ref<RenderingEngineND> &p_engine);
 	void unregister_rendering_engine(const String &p_friendly_name);
 	PackedStringArray get_rendering_engine_names() const;
 	Ref<RenderingEngineND> get_rendering_engine_from_name(const String &p_friendly_name) const;
 
+	bool is_redraw_on_change_enabled() const;
+	void set_redraw_on_change_enabled(const bool p_enabled);
+	void request_redraw();
+	// Internal use only, do not expose. Safe to call when the singleton does not exist.
+	static void mark_redraw_needed() {
+		if (singleton != nullptr) {
+			singleton->_is_redraw_needed = true;
+		}
+	}
+
 	static RenderingServerND *get_singleton() { return singleton; }
 	RenderingServerND() { singleton = this; }
 	~RenderingServerND();
@@ -1,17 +1,219 @@
 #include "wireframe_canvas_rendering_engine_nd.h"
 
+#include "../../math/inline_vector_nd.h"
 #include "../../math/vector_nd.h"
 #include "../../model/mesh/wire/wire_material_nd.h"
+#include "../../parallel_chunks_nd.h"
 #include "../environment/sky/plain_sky_material_nd.h"
 #include "../environment/world_environment_nd.h"
 #include "../rendering_server_nd.h"
 #include "wireframe_render_canvas_nd.h"
 
-Color _get_material_edge_color(const Ref<MaterialND> &p_material, const Ref<MeshND> &p_mesh, int p_edge_index) {
-	if (p_material.is_null()) {
-		return Color(1.0f, 1.0f, 1.0f);
+// Clips the parameter range [r_enter_weight, r_exit_weight] of the edge from A to B to the side of the hyperplane
+// where the signed distance is not negative, given the signed distances of A and B. Returns false if nothing is left.
+static _FORCE_INLINE_ bool _clip_edge_to_half_space(const double p_a_distance, const double p_b_distance, double &r_enter_weight, double &r_exit_weight) {
+	if (p_a_distance < 0.0) {
+		if (p_b_distance < 0.0) {
+			return false;
+		}
+		r_enter_weight = MAX(r_enter_weight, p_a_distance / (p_a_distance - p_b_distance));
+	} else if (p_b_distance < 0.0) {
+		r_exit_weight = MIN(r_exit_weight, p_a_distance / (p_a_distance - p_b_distance));
+	}
+	return r_enter_weight <= r_exit_weight;
+}
+
+bool WireframeCanvasRenderingEngineND::_clip_edge_to_view_volume(const WireframeFrameParams &p_params, const double *p_a, const double *p_b, double &r_enter_weight, double &r_exit_weight) {
+	// -Z is forward. Only X and Y are projected onto the screen, the other axes only affect fading,
+	// so the view volume is bounded by the near and far planes and four side planes using X, Y, and Z.
+	if (!_clip_edge_to_half_space(-p_params.clip_near - p_a[2], -p_params.clip_near - p_b[2], r_enter_weight, r_exit_weight)) {
+		return false;
+	}
+	if (!_clip_edge_to_half_space(p_a[2] + p_params.clip_far, p_b[2] + p_params.clip_far, r_enter_weight, r_exit_weight)) {
+		return false;
+	}
+	const Vector2 half_extents = p_params.view_half_extents;
+	if (half_extents.x <= 0.0f || half_extents.y <= 0.0f) {
+		return true;
+	}
+	if (p_params.has_perspective) {
+		if (p_params.focal_length <= 0.0) {
+			return true;
+		}
+		// A point is inside when focal_length * abs(x) <= half_x * depth, where depth is -z.
+		const double focal = p_params.focal_length;
+		const double a_depth_x = half_extents.x * -p_a[2];
+		const double b_depth_x = half_extents.x * -p_b[2];
+		const double a_depth_y = half_extents.y * -p_a[2];
+		const double b_depth_y = half_extents.y * -p_b[2];
+		return _clip_edge_to_half_space(a_depth_x - focal * p_a[0], b_depth_x - focal * p_b[0], r_enter_weight, r_exit_weight) &&
+				_clip_edge_to_half_space(a_depth_x + focal * p_a[0], b_depth_x + focal * p_b[0], r_enter_weight, r_exit_weight) &&
+				_clip_edge_to_half_space(a_depth_y - focal * p_a[1], b_depth_y - focal * p_b[1], r_enter_weight, r_exit_weight) &&
+				_clip_edge_to_half_space(a_depth_y + focal * p_a[1], b_depth_y + focal * p_b[1], r_enter_weight, r_exit_weight);
 	}
-	return p_material->get_albedo_color_of_edge(p_edge_index, p_mesh);
+	const double half_x = half_extents.x * p_params.orthographic_size;
+	const double half_y = half_extents.y * p_params.orthographic_size;
+	return _clip_edge_to_half_space(half_x - p_a[0], half_x - p_b[0], r_enter_weight, r_exit_weight) &&
+			_clip_edge_to_half_space(half_x + p_a[0], half_x + p_b[0], r_enter_weight, r_exit_weight) &&
+			_clip_edge_to_half_space(half_y - p_a[1], half_y - p_b[1], r_enter_weight, r_exit_weight) &&
+			_clip_edge_to_half_space(half_y + p_a[1], half_y + p_b[1], r_enter_weight, r_exit_weight);
+}
+
+void WireframeCanvasRenderingEngineND::_project_mesh_chunk(void *p_userdata, uint32_t p_chunk) {
+	const WireframeFrameParams &params = *(const WireframeFrameParams *)p_userdata;
+	int64_t job_begin = 0;
+	int64_t job_end = 0;
+	ParallelChunksND::get_chunk_range(params.job_count, params.chunk_count, p_chunk, job_begin, job_end);
+	// Scratch buffers for this chunk, reused for each of its meshes.
+	WireframeChunkScratch scratch;
+	for (int64_t job_index = job_begin; job_index < job_end; job_index++) {
+		_project_mesh_edges(params, params.jobs[job_index], scratch);
+	}
+}
+
+void WireframeCanvasRenderingEngineND::_project_mesh_edges(const WireframeFrameParams &p_params, WireframeMeshJob &r_job, WireframeChunkScratch &r_scratch) {
+	const CameraND *camera = p_params.camera;
+	const int64_t vertex_count = r_job.vertex_count;
+	r_job.edge_vertex_count = 0;
+	if (vertex_count == 0) {
+		return;
+	}
+	InlineVectorN &clipped = r_scratch.clipped;
+	InlineVectorN &perp_dimensions = r_scratch.perp_dimensions;
+	int relative_stride = 0;
+	r_job.relative_transform->xform_many_flat(r_job.vertices_flat, vertex_count, r_job.vertex_stride, r_scratch.camera_relative_vertices, relative_stride);
+	const double *relative_ptr = r_scratch.camera_relative_vertices.ptr();
+	const bool direct_project = relative_stride < 3;
+	PackedVector2Array &projected_vertices = r_scratch.projected_vertices;
+	if (projected_vertices.size() < vertex_count) {
+		projected_vertices.resize(vertex_count);
+	}
+	// Vertex distances are only needed for depth fading, which averages them for each edge.
+	PackedFloat64Array &vertex_distances = r_scratch.vertex_distances;
+	const bool needs_distances = p_params.has_depth_fade && !direct_project;
+	if (needs_distances && vertex_distances.size() < vertex_count) {
+		vertex_distances.resize(vertex_count);
+	}
+	camera->project_many_ptr(relative_ptr, vertex_count, relative_stride, direct_project, p_params.pixel_scale, p_params.pixel_offset, projected_vertices.ptrw(), needs_distances ? vertex_distances.ptrw() : nullptr);
+	const double *distances_ptr = vertex_distances.ptr();
+	const PackedInt32Array &edge_indices = r_job.edge_indices;
+	const int64_t edge_count = edge_indices.size() / 2;
+	// Each edge outputs at most two vertices, so reserve for all of them and write through pointers.
+	if (r_job.edge_vertices.size() < edge_count * 2) {
+		r_job.edge_vertices.resize(edge_count * 2);
+		r_job.edge_colors.resize(edge_count);
+	}
+	Vector2 *edge_vertices_ptrw = r_job.edge_vertices.ptrw();
+	Color *edge_colors_ptrw = r_job.edge_colors.ptrw();
+	// The job setup made sure that there is a color for every edge.
+	const Color *material_edge_colors_ptr = r_job.material_edge_colors.ptr();
+	int64_t edge_vertex_count = 0;
+	for (int edge_index = 0; edge_index < edge_count; edge_index++) {
+		const int a_index = edge_indices[edge_index * 2];
+		const int b_index = edge_indices[edge_index * 2 + 1];
+		ERR_CONTINUE(a_index < 0 || a_index >= vertex_count);
+		ERR_CONTINUE(b_index < 0 || b_index >= vertex_count);
+		const double *a_vert_nd = relative_ptr + a_index * relative_stride;
+		const double *b_vert_nd = relative_ptr + b_index * relative_stride;
+		Color edge_color = material_edge_colors_ptr[edge_index];
+		if (direct_project) {
+			// No clipping or fading is required for 0D, 1D, or 2D relative vertices.
+			edge_vertices_ptrw[edge_vertex_count] = projected_vertices[a_index];
+			edge_vertices_ptrw[edge_vertex_count + 1] = projected_vertices[b_index];
+			edge_colors_ptrw[edge_vertex_count / 2] = edge_color;
+			edge_vertex_count += 2;
+			continue;
+		}
+		// Clip the edge to the part inside of the view volume, as parameters along A to B.
+		double enter_weight = 0.0;
+		double exit_weight = 1.0;
+		if (!_clip_edge_to_view_volume(p_params, a_vert_nd, b_vert_nd, enter_weight, exit_weight)) {
+			continue;
+		}
+		const double a_z = a_vert_nd[2];
+		const double b_z = b_vert_nd[2];
+		if (p_params.has_perp_fading) {
+			double fade_denom = p_params.perp_fade_distance;
+			if (p_params.has_perspective) {
+				fade_denom += p_params.perp_fade_slope * -0.5f * (a_z + b_z);
+			}
+			// Average the components beyond XYZ of both endpoints, scaled by the fade denominator.
+			perp_dimensions.resize(0);
+			if (relative_stride > 3) {
+				perp_dimensions.add_in_place(a_vert_nd + 3, relative_stride - 3);
+				perp_dimensions.add_in_place(b_vert_nd + 3, relative_stride - 3);
+			}
+			perp_dimensions.multiply_scalar_in_place(0.5 / fade_denom);
+			switch (perp_dimensions.size()) {
+				case 0:
+					break;
+				case 1: {
+					const double perp_w = perp_dimensions[0];
+					const double perp_magnitude = ABS(perp_w);
+					if (p_params.has_perp_fade_hue_shift) {
+						const float value = edge_color.get_v();
+						const float half_value = edge_color.get_v();
+						const Color target_color = perp_w > 0.0 ? Color(value, half_value, 0.0f) : Color(0.0f, half_value, value);
+						edge_color = edge_color.lerp(target_color, MIN(1.0, perp_magnitude));
+					}
+					if (p_params.has_perp_fade_transparency) {
+						edge_color.a = 1.0 - MIN(1.0, perp_magnitude);
+					}
+				} break;
+				default: {
+					const double perp_magnitude = perp_dimensions.length();
+					if (p_params.has_perp_fade_hue_shift) {
+						const double perp_w = perp_dimensions[0];
+						const double perp_v = perp_dimensions[1];
+						const float target_hue = Math::atan2(-perp_v, perp_w) / Math_TAU + (13.0 / 12.0);
+						const Color target_color = Color::from_hsv(target_hue, 1.0, edge_color.get_v());
+						edge_color = edge_color.lerp(target_color, MIN(1.0, perp_magnitude));
+					}
+					if (p_params.has_perp_fade_transparency) {
+						edge_color.a = 1.0 - MIN(1.0, perp_magnitude);
+					}
+				} break;
+			}
+		}
+		if (p_params.has_depth_fade) {
+			const double depth = (distances_ptr[a_index] + distances_ptr[b_index]) * 0.5;
+			double alpha = 1.0;
+
+			const double depth_far = p_params.clip_far;
+			const double start = p_params.depth_fade_start;
+
+			if (depth > depth_far) {
+				alpha = 0.0;
+			} else if (depth < start) {
+				alpha = 1.0;
+			} else {
+				const double unit_distance = (depth - start) / (depth_far - start); // Inverse lerp
+				alpha = 1.0 - unit_distance;
+			}
+
+			edge_color.a *= alpha;
+		}
+		if (edge_color.a <= 0.0f) {
+			// Fully faded out, so there is nothing to draw.
+			continue;
+		}
+		// Only endpoints moved by clipping need to be projected, the others were projected once per vertex.
+		if (enter_weight > 0.0) {
+			InlineVectorN::lerp(a_vert_nd, relative_stride, b_vert_nd, relative_stride, enter_weight, clipped);
+			camera->project_many_ptr(clipped.ptr(), 1, clipped.size(), false, p_params.pixel_scale, p_params.pixel_offset, edge_vertices_ptrw + edge_vertex_count);
+		} else {
+			edge_vertices_ptrw[edge_vertex_count] = projected_vertices[a_index];
+		}
+		if (exit_weight < 1.0) {
+			InlineVectorN::lerp(a_vert_nd, relative_stride, b_vert_nd, relative_stride, exit_weight, clipped);
+			camera->project_many_ptr(clipped.ptr(), 1, clipped.size(), false, p_params.pixel_scale, p_params.pixel_offset, edge_vertices_ptrw + edge_vertex_count + 1);
+		} else {
+			edge_vertices_ptrw[edge_vertex_count + 1] = projected_vertices[b_index];
+		}
+		edge_colors_ptrw[edge_vertex_count / 2] = edge_color;
+		edge_vertex_count += 2;
+	}
+	r_job.edge_vertex_count = edge_vertex_count;
 }
 
 void WireframeCanvasRenderingEngineND::setup_for_viewport() {
@@ -47,154 +249,71 @@ void WireframeCanvasRenderingEngineND::render_frame() {
 		}
 	}
 	wire_canvas->set_background_color(background_color);
-	// Draw edges for each mesh instance in the scene.
-	Vector<PackedColorArray> edge_colors_to_draw;
-	PackedFloat32Array edge_thicknesses_to_draw;
-	Vector<PackedVector2Array> edge_vertices_to_draw;
-	const PackedInt64Array mesh_instance_object_ids = get_mesh_instance_object_ids();
-	const TypedArray<TransformND> mesh_relative_transforms = get_mesh_relative_transforms();
-	const bool camera_has_perspective = camera->get_projection_type() == CameraND::PROJECTION_PERSPECTIVE;
-	const bool camera_has_perp_fading = camera->get_perp_fade_mode() != CameraND::PERP_FADE_DISABLED;
-	const bool camera_has_perp_fade_hue_shift = camera->get_perp_fade_mode() & CameraND::PERP_FADE_HUE_SHIFT;
-	const bool camera_has_perp_fade_transparency = camera->get_perp_fade_mode() & CameraND::PERP_FADE_TRANSPARENCY;
-	const double camera_clip_far = camera->get_clip_far();
-	const double camera_clip_near = camera->get_clip_near();
-	for (int64_t mesh_index = 0; mesh_index < mesh_instance_object_ids.size(); mesh_index++) {
-		const ObjectID mesh_instance_object_id = (ObjectID)mesh_instance_object_ids[mesh_index];
-		MeshInstanceND *mesh_inst = Object::cast_to<MeshInstanceND>(ObjectDB::get_instance(mesh_instance_object_id));
-		ERR_CONTINUE(mesh_inst == nullptr);
-		const Ref<MeshND> mesh = mesh_inst->get_mesh();
-		const Ref<MaterialND> material = mesh_inst->get_active_material();
-		const Ref<TransformND> mesh_relative_transform = mesh_relative_transforms[mesh_index];
-		const Vector<VectorN> camera_relative_vertices = mesh_relative_transform->xform_many(mesh->get_vertices());
-		if (camera_relative_vertices.is_empty()) {
-			continue;
-		}
-		const bool direct_project = camera_relative_vertices[0].size() < 3;
-		PackedVector2Array projected_vertices;
-		{
-			const int64_t vertex_count = camera_relative_vertices.size();
-			projected_vertices.resize(vertex_count);
-			for (int vertex = 0; vertex < vertex_count; vertex++) {
-				projected_vertices.set(vertex, camera->world_to_viewport_local_normal(camera_relative_vertices[vertex], direct_project));
-			}
+	// Project straight to canvas pixels, so the canvas can submit the edges without another pass.
+	const Vector2 half_size = wire_canvas->get_size() * 0.5f;
+	const Vector2 pixel_scale = camera->get_keep_aspect() == CameraND::KEEP_WIDTH ? Vector2(half_size.x, half_size.x) : Vector2(half_size.y, half_size.y);
+	// Project and color the edges of every mesh instance. Each mesh is independent, so this runs in parallel.
+	// Anything that may lazily fill a cache is read here on this thread first, so the jobs only read shared data.
+	// This includes the edge colors, which are cached per mesh and material instead of looked up for each edge.
+	const Vector<MeshRenderItem> &render_items = get_render_items();
+	const int64_t job_count = render_items.size();
+	_mesh_jobs.resize(job_count);
+	WireframeMeshJob *jobs_ptrw = _mesh_jobs.ptrw();
+	for (int64_t job_index = 0; job_index < job_count; job_index++) {
+		const MeshRenderItem &render_item = render_items[job_index];
+		WireframeMeshJob &job = jobs_ptrw[job_index];
+		job.mesh = render_item.mesh_instance->get_mesh();
+		job.material = render_item.material;
+		job.relative_transform = render_item.relative_transform;
+		// On a mismatch, the vertex count is zero, so the job draws nothing.
+		job.mesh->get_vertices_flat_checked(job.vertices_flat, job.vertex_count, job.vertex_stride);
+		job.edge_indices = job.mesh->get_edge_indices();
+		job.material_edge_colors = _get_edge_colors(job.mesh, job.material);
+		if (unlikely(job.material_edge_colors.size() < job.edge_indices.size() / 2)) {
+			// Checked here instead of in the job, so the job draws nothing instead of stale output from an earlier frame.
+			ERR_PRINT("WireframeCanvasRenderingEngineND: Mesh '" + job.mesh->get_name() + "' has fewer edge colors than edges, so it will not be drawn this frame.");
+			job.vertex_count = 0;
 		}
-		PackedColorArray edge_colors;
-		PackedVector2Array edge_vertices;
-		const PackedInt32Array edge_indices = mesh->get_edge_indices();
-		for (int edge_index = 0; edge_index < edge_indices.size() / 2; edge_index++) {
-			const int a_index = edge_indices[edge_index * 2];
-			const int b_index = edge_indices[edge_index * 2 + 1];
-			const VectorN a_vert_nd = camera_relative_vertices[a_index];
-			const VectorN b_vert_nd = camera_relative_vertices[b_index];
-			Color edge_color;
-			if (direct_project) {
-				// No clipping or fading is required for 0D, 1D, or 2D relative vertices.
-				edge_vertices.push_back(projected_vertices[a_index]);
-				edge_vertices.push_back(projected_vertices[b_index]);
-				edge_color = _get_material_edge_color(material, mesh_inst->get_mesh(), edge_index);
-			} else {
-				const double a_z = a_vert_nd[2];
-				const double b_z = b_vert_nd[2];
-				if (a_z > -camera_clip_near) {
-					if (b_z > -camera_clip_near) {
-						// Both points are behind the camera, so we skip this edge.
-						continue;
-					} else {
-						// A is behind the camera, while B is in front of the camera.
-						const double factor = (a_z + camera_clip_near) / (a_z - b_z);
-						const VectorN clipped = VectorND::lerp(a_vert_nd, b_vert_nd, factor);
-						edge_vertices.push_back(camera->world_to_viewport_local_normal(clipped));
-						edge_vertices.push_back(projected_vertices[b_index]);
-					}
-				} else {
-					edge_vertices.push_back(projected_vertices[a_index]);
-					if (b_z > -camera_clip_near) {
-						// B is behind the camera, while A is in front of the camera.
-						const double factor = (b_z + camera_clip_near) / (b_z - a_z);
-						const VectorN clipped = VectorND::lerp(b_vert_nd, a_vert_nd, factor);
-						edge_vertices.push_back(camera->world_to_viewport_local_normal(clipped));
-					} else {
-						// Both points are in front of the camera, so render the edge as-is.
-						edge_vertices.push_back(projected_vertices[b_index]);
-					}
-				}
-				edge_color = _get_material_edge_color(material, mesh_inst->get_mesh(), edge_index);
-				if (camera_has_perp_fading) {
-					double fade_denom = camera->get_perp_fade_distance();
-					if (camera_has_perspective) {
-						fade_denom += camera->get_perp_fade_slope() * -0.5f * (a_z + b_z);
-					}
-					const VectorN a_perp = VectorND::drop_first_dimensions(a_vert_nd, 3);
-					const VectorN b_perp = VectorND::drop_first_dimensions(b_vert_nd, 3);
-					const VectorN perp_dimensions = VectorND::multiply_scalar(VectorND::add(a_perp, b_perp), 0.5 / fade_denom);
-					switch (perp_dimensions.size()) {
-						case 0:
-							break;
-						case 1: {
-							const double perp_w = perp_dimensions[0];
-							const double perp_magnitude = ABS(perp_w);
-							if (camera_has_perp_fade_hue_shift) {
-								const float value = edge_color.get_v();
-								const float half_value = edge_color.get_v();
-								const Color target_color = perp_w > 0.0 ? Color(value, half_value, 0.0f) : Color(0.0f, half_value, value);
-								edge_color = edge_color.lerp(target_color, MIN(1.0, perp_magnitude));
-							}
-							if (camera_has_perp_fade_transparency) {
-								edge_color.a = 1.0 - MIN(1.0, perp_magnitude);
-							}
-						} break;
-						default: {
-							const double perp_magnitude = VectorND::length(perp_dimensions);
-							if (camera_has_perp_fade_hue_shift) {
-								const double perp_w = perp_dimensions[0];
-								const double perp_v = perp_dimensions[1];
-								const float target_hue = Math::atan2(-perp_v, perp_w) / Math_TAU + (13.0 / 12.0);
-								const Color target_color = Color::from_hsv(target_hue, 1.0, edge_color.get_v());
-								edge_color = edge_color.lerp(target_color, MIN(1.0, perp_magnitude));
-							}
-							if (camera_has_perp_fade_transparency) {
-								edge_color.a = 1.0 - MIN(1.0, perp_magnitude);
-							}
-						} break;
-					}
-				}
-			}
-			if (camera->get_depth_fade()) {
-				const double depth = Math::abs((VectorND::length(a_vert_nd) + VectorND::length(b_vert_nd)) * 0.5);
-				double alpha = 1.0;
-
-				const double depth_far = camera_clip_far;
-				const double start = camera->get_depth_fade_start();
-
-				if (depth > depth_far) {
-					alpha = 0.0;
-				} else if (depth < start) {
-					alpha = 1.0;
-				} else {
-					const double unit_distance = (depth - start) / (depth_far - start); // Inverse lerp
-					alpha = 1.0 - unit_distance;
-				}
-
-				edge_color.a *= alpha;
-			}
-			edge_colors.push_back(edge_color);
-		}
-		if (edge_vertices.is_empty()) {
-			continue;
-		}
-		edge_colors_to_draw.push_back(edge_colors);
-		const Ref<WireMaterialND> wire_material = material;
+		const Ref<WireMaterialND> wire_material = job.material;
 		if (wire_material.is_valid()) {
-			edge_thicknesses_to_draw.push_back(wire_material->get_line_thickness() > 0.0 ? wire_material->get_line_thickness() : -1.0);
+			job.thickness = wire_material->get_line_thickness() > 0.0 ? wire_material->get_line_thickness() : -1.0;
 		} else {
-			edge_thicknesses_to_draw.push_back(-1.0);
+			job.thickness = -1.0;
 		}
-		edge_vertices_to_draw.push_back(edge_vertices);
 	}
-	wire_canvas->set_camera_aspect(camera->get_keep_aspect());
-	wire_canvas->set_edge_colors_to_draw(edge_colors_to_draw);
-	wire_canvas->set_edge_thicknesses_to_draw(edge_thicknesses_to_draw);
-	wire_canvas->set_edge_vertices_to_draw(edge_vertices_to_draw);
+	WireframeFrameParams params;
+	params.camera = camera;
+	params.has_perspective = camera->get_projection_type() == CameraND::PROJECTION_PERSPECTIVE;
+	params.has_perp_fading = camera->get_perp_fade_mode() != CameraND::PERP_FADE_DISABLED;
+	params.has_perp_fade_hue_shift = camera->get_perp_fade_mode() & CameraND::PERP_FADE_HUE_SHIFT;
+	params.has_perp_fade_transparency = camera->get_perp_fade_mode() & CameraND::PERP_FADE_TRANSPARENCY;
+	params.has_depth_fade = camera->get_depth_fade();
+	params.clip_far = camera->get_clip_far();
+	params.clip_near = camera->get_clip_near();
+	params.perp_fade_distance = camera->get_perp_fade_distance();
+	params.perp_fade_slope = camera->get_perp_fade_slope();
+	params.depth_fade_start = camera->get_depth_fade_start();
+	params.view_half_extents = camera->get_view_half_extents(wire_canvas->get_size());
+	params.focal_length = camera->get_focal_length();
+	params.orthographic_size = camera->get_orthographic_size();
+	params.pixel_scale = pixel_scale;
+	params.pixel_offset = half_size;
+	params.jobs = jobs_ptrw;
+	params.job_count = job_count;
+	params.chunk_count = ParallelChunksND::get_chunk_count(job_count, 1);
+	ParallelChunksND::run_chunks(&WireframeCanvasRenderingEngineND::_project_mesh_chunk, &params, params.chunk_count, "WireframeCanvasRenderingEngineND: Project meshes");
+	// Merge in render list order, so the output does not depend on how the work was scheduled.
+	wire_canvas->clear_edges();
+	for (int64_t job_index = 0; job_index < job_count; job_index++) {
+		WireframeMeshJob &job = jobs_ptrw[job_index];
+		wire_canvas->add_edges(job.thickness, job.edge_vertices.ptr(), job.edge_colors.ptr(), job.edge_vertex_count);
+		// Don't keep references to resources until the next frame, but keep the output buffers.
+		job.mesh.unref();
+		job.material.unref();
+		job.relative_transform.unref();
+		job.vertices_flat = PackedFloat64Array();
+		job.edge_indices = PackedInt32Array();
+		job.material_edge_colors = PackedColorArray();
+	}
 	wire_canvas->queue_redraw();
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../../math/inline_vector_nd.h"
 #include "../rendering_engine_nd.h"
 
 // Trivial CPU-based renderer that draws wireframes to a Control-based canvas.
@@ -8,6 +9,61 @@
 class WireframeCanvasRenderingEngineND : public RenderingEngineND {
 	GDCLASS(WireframeCanvasRenderingEngineND, RenderingEngineND);
 
+	// Inputs are gathered on the rendering thread, outputs are written by exactly one parallel chunk.
+	// The output buffers stay with the job slot between frames, and only edge_vertex_count of them are used.
+	struct WireframeMeshJob {
+		Ref<MeshND> mesh;
+		Ref<MaterialND> material;
+		Ref<TransformND> relative_transform;
+		PackedFloat64Array vertices_flat;
+		PackedInt32Array edge_indices;
+		PackedColorArray material_edge_colors;
+		int64_t vertex_count = 0;
+		int vertex_stride = 0;
+		float thickness = -1.0f;
+		int64_t edge_vertex_count = 0;
+		PackedVector2Array edge_vertices;
+		PackedColorArray edge_colors;
+	};
+
+	struct WireframeFrameParams {
+		const CameraND *camera = nullptr;
+		WireframeMeshJob *jobs = nullptr;
+		int64_t job_count = 0;
+		int64_t chunk_count = 0;
+		// Maps normalized viewport coordinates to canvas pixels.
+		Vector2 pixel_scale;
+		Vector2 pixel_offset;
+		// Half of the visible size in normalized viewport coordinates, see CameraND::get_view_half_extents().
+		Vector2 view_half_extents;
+		double focal_length = 0.0;
+		double orthographic_size = 0.0;
+		double clip_near = 0.0;
+		double clip_far = 0.0;
+		double perp_fade_distance = 0.0;
+		double perp_fade_slope = 0.0;
+		double depth_fade_start = 0.0;
+		bool has_perspective = false;
+		bool has_perp_fading = false;
+		bool has_perp_fade_hue_shift = false;
+		bool has_perp_fade_transparency = false;
+		bool has_depth_fade = false;
+	};
+
+	struct WireframeChunkScratch {
+		PackedFloat64Array camera_relative_vertices;
+		PackedVector2Array projected_vertices;
+		PackedFloat64Array vertex_distances;
+		InlineVectorN clipped;
+		InlineVectorN perp_dimensions;
+	};
+
+	Vector<WireframeMeshJob> _mesh_jobs;
+
+	static bool _clip_edge_to_view_volume(const WireframeFrameParams &p_params, const double *p_a, const double *p_b, double &r_enter_weight, double &r_exit_weight);
+	static void _project_mesh_chunk(void *p_userdata, uint32_t p_chunk);
+	static void _project_mesh_edges(const WireframeFrameParams &p_params, WireframeMeshJob &r_job, WireframeChunkScratch &r_scratch);
+
 protected:
 	static void _bind_methods() {}
 
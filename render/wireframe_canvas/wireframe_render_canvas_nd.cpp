@@ -1,46 +1,91 @@
 #include "wireframe_render_canvas_nd.h"
 
-#if GODOT_MODULE
+#include "../rendering_server_nd.h"
+
 void WireframeRenderCanvasND::_notification(int p_what) {
-	if (p_what == NOTIFICATION_DRAW) {
-		_draw();
+	switch (p_what) {
+#if GODOT_MODULE
+		case NOTIFICATION_DRAW: {
+			_draw();
+		} break;
+#endif // GODOT_MODULE
+		case NOTIFICATION_RESIZED: {
+			// Edges are stored in pixel space, so they need to be projected again for the new size.
+			RenderingServerND::mark_redraw_needed();
+		} break;
 	}
 }
-#endif // GODOT_MODULE
 
 void WireframeRenderCanvasND::_draw() {
 	draw_rect(Rect2(Vector2(), get_size()), _background_color);
-	const Vector2 half_size = get_size() * 0.5f;
-	const Vector2 project_scale = _camera_aspect == CameraND::KEEP_WIDTH ? Vector2(half_size.x, half_size.x) : Vector2(half_size.y, half_size.y);
-	for (int i = 0; i < _edge_vertices_to_draw.size(); i++) {
-		const PackedVector2Array edge_verts = _edge_vertices_to_draw[i];
-		PackedVector2Array verts;
-		verts.resize(edge_verts.size());
-		for (int vertex_index = 0; vertex_index < edge_verts.size(); vertex_index++) {
-			verts.set(vertex_index, edge_verts[vertex_index] * project_scale + half_size);
+	EdgeBatch *batches_ptrw = _edge_batches.ptrw();
+	for (int64_t i = 0; i < _edge_batches.size(); i++) {
+		EdgeBatch &batch = batches_ptrw[i];
+		if (batch.vertex_count == 0) {
+			continue;
 		}
-		draw_multiline_colors(verts, _edge_colors_to_draw[i], _edge_thicknesses_to_draw[i]);
+		// Trim to the used size. This stays within the allocated capacity, so it does not reallocate.
+		if (batch.vertices.size() != batch.vertex_count) {
+			batch.vertices.resize(batch.vertex_count);
+			batch.colors.resize(batch.vertex_count / 2);
+		}
+		draw_multiline_colors(batch.vertices, batch.colors, batch.thickness);
 	}
 }
 
-void WireframeRenderCanvasND::set_background_color(const Color &p_background_color) {
-	_background_color = p_background_color;
-}
-
-void WireframeRenderCanvasND::set_camera_aspect(const CameraND::KeepAspect p_camera_aspect) {
-	_camera_aspect = p_camera_aspect;
+int64_t WireframeRenderCanvasND::_get_or_create_edge_batch_index(const float p_thickness) {
+	// Most scenes use only a few thicknesses, and consecutive meshes often share one.
+	if (_last_edge_batch_index >= 0 && _edge_batches[_last_edge_batch_index].thickness == p_thickness) {
+		return _last_edge_batch_index;
+	}
+	for (int64_t i = 0; i < _edge_batches.size(); i++) {
+		if (_edge_batches[i].thickness == p_thickness) {
+			_last_edge_batch_index = i;
+			return i;
+		}
+	}
+	EdgeBatch batch;
+	batch.thickness = p_thickness;
+	_edge_batches.push_back(batch);
+	_last_edge_batch_index = _edge_batches.size() - 1;
+	return _last_edge_batch_index;
 }
 
-void WireframeRenderCanvasND::set_edge_colors_to_draw(const Vector<PackedColorArray> &p_edge_colors_to_draw) {
-	_edge_colors_to_draw = p_edge_colors_to_draw;
+void WireframeRenderCanvasND::set_background_color(const Color &p_background_color) {
+	_background_color = p_background_color;
 }
 
-void WireframeRenderCanvasND::set_edge_thicknesses_to_draw(const PackedFloat32Array &p_edge_thicknesses_to_draw) {
-	_edge_thicknesses_to_draw = p_edge_thicknesses_to_draw;
+void WireframeRenderCanvasND::clear_edges() {
+	// Drop batches which were not used last frame, so thicknesses that are no longer used don't keep their buffers.
+	for (int64_t i = _edge_batches.size() - 1; i >= 0; i--) {
+		if (_edge_batches[i].vertex_count == 0) {
+			_edge_batches.remove_at(i);
+		}
+	}
+	EdgeBatch *batches_ptrw = _edge_batches.ptrw();
+	for (int64_t i = 0; i < _edge_batches.size(); i++) {
+		batches_ptrw[i].vertex_count = 0;
+	}
+	_last_edge_batch_index = -1;
 }
 
-void WireframeRenderCanvasND::set_edge_vertices_to_draw(const Vector<PackedVector2Array> &p_edge_vertices_to_draw) {
-	_edge_vertices_to_draw = p_edge_vertices_to_draw;
+void WireframeRenderCanvasND::add_edges(const float p_thickness, const Vector2 *p_vertices, const Color *p_colors, const int64_t p_vertex_count) {
+	ERR_FAIL_COND_MSG(p_vertex_count % 2 != 0, "WireframeRenderCanvasND: Edge vertex count must be even.");
+	if (p_vertex_count == 0) {
+		return;
+	}
+	EdgeBatch &batch = _edge_batches.ptrw()[_get_or_create_edge_batch_index(p_thickness)];
+	const int64_t new_vertex_count = batch.vertex_count + p_vertex_count;
+	if (batch.vertices.size() < new_vertex_count) {
+		const int64_t capacity = MAX(new_vertex_count, batch.vertices.size() * 2);
+		batch.vertices.resize(capacity);
+		batch.colors.resize(capacity / 2);
+	}
+	Vector2 *vertices_ptrw = batch.vertices.ptrw();
+	Color *colors_ptrw = batch.colors.ptrw();
+	memcpy(vertices_ptrw + batch.vertex_count, p_vertices, sizeof(Vector2) * p_vertex_count);
+	memcpy(colors_ptrw + batch.vertex_count / 2, p_colors, sizeof(Color) * (p_vertex_count / 2));
+	batch.vertex_count = new_vertex_count;
 }
 
 WireframeRenderCanvasND::WireframeRenderCanvasND() {
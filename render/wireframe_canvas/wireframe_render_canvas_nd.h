@@ -11,17 +11,24 @@
 class WireframeRenderCanvasND : public Control {
 	GDCLASS(WireframeRenderCanvasND, Control);
 
+	// All edges with the same thickness are drawn with a single canvas command.
+	// The buffers are kept between frames and only grow, so steady-state frames don't allocate.
+	struct EdgeBatch {
+		float thickness = -1.0f;
+		int64_t vertex_count = 0;
+		PackedVector2Array vertices;
+		PackedColorArray colors;
+	};
+
 	Color _background_color = Color(0.0f, 0.0f, 0.0f);
-	CameraND::KeepAspect _camera_aspect = CameraND::KEEP_HEIGHT;
-	Vector<PackedColorArray> _edge_colors_to_draw;
-	PackedFloat32Array _edge_thicknesses_to_draw;
-	Vector<PackedVector2Array> _edge_vertices_to_draw;
+	Vector<EdgeBatch> _edge_batches;
+	int64_t _last_edge_batch_index = -1;
+
+	int64_t _get_or_create_edge_batch_index(const float p_thickness);
 
 protected:
 	static void _bind_methods() {}
-#if GODOT_MODULE
 	void _notification(int p_what);
-#endif
 
 public:
 #if GDEXTENSION
@@ -31,10 +38,11 @@ public:
 #endif
 
 	void set_background_color(const Color &p_background_color);
-	void set_camera_aspect(const CameraND::KeepAspect p_camera_aspect);
-	void set_edge_colors_to_draw(const Vector<PackedColorArray> &p_edge_colors_to_draw);
-	void set_edge_thicknesses_to_draw(const PackedFloat32Array &p_edge_thicknesses_to_draw);
-	void set_edge_vertices_to_draw(const Vector<PackedVector2Array> &p_edge_vertices_to_draw);
+
+	// Internal use only, do not expose.
+	// Vertices are in canvas pixel space, with one color per edge (every two vertices).
+	void clear_edges();
+	void add_edges(const float p_thickness, const Vector2 *p_vertices, const Color *p_colors, const int64_t p_vertex_count);
 
 	WireframeRenderCanvasND();
 };
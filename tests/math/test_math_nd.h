@@ -0,0 +1,72 @@
+#pragma once
+
+#include "../../math/math_nd.h"
+
+#include "tests/test_macros.h"
+
+#include <string.h>
+
+namespace TestMathND {
+TEST_CASE("[MathND] Batch float16 decoding matches scalar decoding for every value") {
+	Vector<uint16_t> float16s;
+	float16s.resize(65536);
+	for (int i = 0; i < 65536; i++) {
+		float16s.set(i, uint16_t(i));
+	}
+	Vector<double> batch;
+	batch.resize(65536);
+	// Also start one value in, so NaNs and finite values are grouped differently on the vectorized path.
+	for (int start = 0; start < 2; start++) {
+		MathND::float16s_to_doubles(float16s.ptr() + start, batch.ptrw(), 65536 - start);
+		int mismatch_count = 0;
+		for (int i = start; i < 65536; i++) {
+			// Compared bitwise, so NaN payloads and the sign of zero must match too.
+			const double scalar = MathND::float16_to_double(uint16_t(i));
+			if (memcmp(&scalar, batch.ptr() + i - start, sizeof(double)) != 0) {
+				mismatch_count++;
+			}
+		}
+		CHECK_MESSAGE(mismatch_count == 0, "MathND float16s_to_doubles should match float16_to_double for every float16 value.");
+	}
+	// Encoding the decoded values in a batch should match encoding them one by one.
+	MathND::float16s_to_doubles(float16s.ptr(), batch.ptrw(), 65536);
+	Vector<uint16_t> encoded;
+	encoded.resize(65536);
+	MathND::doubles_to_float16s(batch.ptr(), encoded.ptrw(), 65536);
+	int mismatch_count = 0;
+	for (int i = 0; i < 65536; i++) {
+		if (encoded[i] != MathND::double_to_float16(batch[i])) {
+			mismatch_count++;
+		}
+	}
+	CHECK_MESSAGE(mismatch_count == 0, "MathND doubles_to_float16s should match double_to_float16 for every float16 value.");
+}
+
+TEST_CASE("[MathND] Batch float8 decoding matches scalar decoding for every value") {
+	uint8_t float8s[256];
+	for (int i = 0; i < 256; i++) {
+		float8s[i] = uint8_t(i);
+	}
+	double batch[256];
+	MathND::float8s_to_doubles(float8s, batch, 256);
+	for (int i = 0; i < 256; i++) {
+		const double scalar = MathND::float8_to_double(uint8_t(i));
+		CHECK_MESSAGE(memcmp(&scalar, batch + i, sizeof(double)) == 0, "MathND float8s_to_doubles should match float8_to_double for every float8 value.");
+	}
+	uint8_t encoded[256];
+	MathND::doubles_to_float8s(batch, encoded, 256);
+	for (int i = 0; i < 256; i++) {
+		CHECK_MESSAGE(encoded[i] == MathND::double_to_float8(batch[i]), "MathND doubles_to_float8s should match double_to_float8 for every float8 value.");
+	}
+}
+
+TEST_CASE("[MathND] Float16 byte arrays are little-endian") {
+	// 1.0 is 0x3C00 and -2.0 is 0xC000 as float16.
+	const PackedByteArray bytes = MathND::double_array_to_float16_bytes(PackedFloat64Array{ 1.0, -2.0 });
+	CHECK(bytes == PackedByteArray{ 0x00, 0x3C, 0x00, 0xC0 });
+	const PackedFloat64Array doubles = MathND::float16_bytes_to_double_array(PackedByteArray{ 0x00, 0x3C, 0x00, 0xC0 });
+	REQUIRE(doubles.size() == 2);
+	CHECK(doubles[0] == 1.0);
+	CHECK(doubles[1] == -2.0);
+}
+} // namespace TestMathND
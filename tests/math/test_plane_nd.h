@@ -1,10 +1,17 @@
 #pragma once
 
 #include "../../math/plane_nd.h"
+#include "../../math/vector_nd.h"
 
 #include "tests/test_macros.h"
 
 namespace TestPlaneND {
+// Exposes the slow path of from_points, which the fast path must agree with.
+class OrthonormalizedTestPlaneND : public PlaneND {
+public:
+	using PlaneND::_from_points_orthonormalized;
+};
+
 TEST_CASE("[PlaneND] Is Finite") {
 	const Ref<PlaneND> finite_plane = PlaneND::from_normal_distance(VectorN{ 0, 1, 0, 0 }, 5.0);
 	CHECK_MESSAGE(finite_plane->is_finite(), "PlaneND is_finite should be true for a plane with finite normal and distance.");
@@ -13,4 +20,64 @@ TEST_CASE("[PlaneND] Is Finite") {
 	const Ref<PlaneND> infinite_distance = PlaneND::from_normal_distance(VectorN{ 0, 1, 0, 0 }, Math_INF);
 	CHECK_MESSAGE(!infinite_distance->is_finite(), "PlaneND is_finite should be false when the distance is infinite.");
 }
+
+TEST_CASE("[PlaneND] From Points") {
+	const double inv_sqrt_3 = 1.0 / Math::sqrt(3.0);
+	Ref<PlaneND> plane = PlaneND::from_points(Vector<VectorN>{ VectorN{ 1, 0, 0 }, VectorN{ 0, 1, 0 }, VectorN{ 0, 0, 1 } });
+	REQUIRE(plane.is_valid());
+	CHECK_MESSAGE(VectorND::is_equal_approx(plane->get_normal(), VectorN{ inv_sqrt_3, inv_sqrt_3, inv_sqrt_3 }), "PlaneND from_points should give the normal of the 3D triangle.");
+	CHECK_MESSAGE(Math::is_equal_approx(plane->get_distance(), inv_sqrt_3), "PlaneND from_points should give the distance of the 3D triangle.");
+	// The orientation follows the order of the points, with a positive determinant when the normal is last.
+	plane = PlaneND::from_points(Vector<VectorN>{ VectorN{ 1, 0, 0, 0 }, VectorN{ 0, 1, 0, 0 }, VectorN{ 0, 0, 1, 0 }, VectorN{ 0, 0, 0, 1 } });
+	REQUIRE(plane.is_valid());
+	CHECK_MESSAGE(VectorND::is_equal_approx(plane->get_normal(), VectorN{ -0.5, -0.5, -0.5, -0.5 }), "PlaneND from_points should give the normal of the 4D tetrahedron.");
+	CHECK_MESSAGE(Math::is_equal_approx(plane->get_distance(), -0.5), "PlaneND from_points should give the distance of the 4D tetrahedron.");
+	// Planes through the origin have no distance.
+	plane = PlaneND::from_points(Vector<VectorN>{ VectorN{ 0, 0, 0 }, VectorN{ 2, 0, 0 }, VectorN{ 0, 3, 0 } });
+	REQUIRE(plane.is_valid());
+	CHECK_MESSAGE(VectorND::is_equal_approx(plane->get_normal(), VectorN{ 0, 0, 1 }), "PlaneND from_points should give a unit normal for a plane through the origin.");
+	CHECK_MESSAGE(Math::is_zero_approx(plane->get_distance()), "PlaneND from_points should give zero distance for a plane through the origin.");
+	// The boundary triangles of a tetrahedron, each wound to face outward.
+	const Vector<VectorN> vertices = { VectorN{ 0, 0, 0 }, VectorN{ 1, 0, 0 }, VectorN{ 0, 1, 0 }, VectorN{ 0, 0, 1 } };
+	const PackedInt32Array simplex_indices = { 0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3 };
+	for (int i = 0; i < 4; i++) {
+		plane = PlaneND::from_points(Vector<VectorN>{ vertices[simplex_indices[i * 3]], vertices[simplex_indices[i * 3 + 1]], vertices[simplex_indices[i * 3 + 2]] });
+		REQUIRE(plane.is_valid());
+		CHECK_MESSAGE(!plane->is_point_over(VectorN{ 0.25, 0.25, 0.25 }), "PlaneND from_points planes of an outward wound tetrahedron should face away from its center.");
+	}
+}
+
+TEST_CASE("[PlaneND] From Points matches the orthonormalized path") {
+	// Simplexes in 2D to 5D, including swapped point orders that flip the orientation.
+	const Vector<Vector<VectorN>> point_sets = {
+		{ VectorN{ 1, 2 }, VectorN{ -3, 0.5 } },
+		{ VectorN{ -3, 0.5 }, VectorN{ 1, 2 } },
+		{ VectorN{ 1, 0, 0 }, VectorN{ 0, 1, 0 }, VectorN{ 0, 0, 1 } },
+		{ VectorN{ 0, 1, 0 }, VectorN{ 1, 0, 0 }, VectorN{ 0, 0, 1 } },
+		{ VectorN{ 2, -1, 0.5 }, VectorN{ 0.25, 3, -2 }, VectorN{ -1, -1, 4 } },
+		{ VectorN{ 1, 2, 0, -1 }, VectorN{ 0, 1, 3, 2 }, VectorN{ -2, 0, 1, 1 }, VectorN{ 1, -1, 2, 0 } },
+		{ VectorN{ 1, 0, 0, 0, 2 }, VectorN{ 0, 1, 0, 1, 0 }, VectorN{ 0, 0, 1, 0, -1 }, VectorN{ 3, 0, 0, 1, 0 }, VectorN{ 0, 2, 1, 0, 1 } },
+	};
+	for (const Vector<VectorN> &points : point_sets) {
+		const Ref<PlaneND> plane = PlaneND::from_points(points);
+		const Ref<PlaneND> expected = OrthonormalizedTestPlaneND::_from_points_orthonormalized(points);
+		REQUIRE(plane.is_valid());
+		REQUIRE(expected.is_valid());
+		CHECK_MESSAGE(plane->is_equal_approx(expected), "PlaneND from_points should give the same normal and orientation as the orthonormalized path.");
+	}
+	// Nearly parallel edges are not trusted by the fast path, so the orthonormalized path is used.
+	const Vector<VectorN> nearly_degenerate = { VectorN{ 0, 0, 1 }, VectorN{ 1, 0, 1 }, VectorN{ 1, 0.000001, 1 } };
+	const Ref<PlaneND> nearly_degenerate_plane = PlaneND::from_points(nearly_degenerate);
+	REQUIRE(nearly_degenerate_plane.is_valid());
+	CHECK(nearly_degenerate_plane->is_equal_approx(OrthonormalizedTestPlaneND::_from_points_orthonormalized(nearly_degenerate)));
+	CHECK(VectorND::is_equal_approx(nearly_degenerate_plane->get_normal(), VectorN{ 0, 0, 1 }));
+	CHECK(Math::is_equal_approx(nearly_degenerate_plane->get_distance(), 1.0));
+	// Collinear or coplanar points do not define a plane, so both paths give a null plane.
+	const Vector<VectorN> collinear = { VectorN{ 0, 0, 0 }, VectorN{ 1, 0, 0 }, VectorN{ 2, 0, 0 } };
+	CHECK_MESSAGE(PlaneND::from_points(collinear).is_null(), "PlaneND from_points should not give a plane for collinear points.");
+	CHECK(OrthonormalizedTestPlaneND::_from_points_orthonormalized(collinear).is_null());
+	const Vector<VectorN> coplanar = { VectorN{ 1, 1, 0, 0 }, VectorN{ 2, 2, 0, 0 }, VectorN{ 3, 1, 0, 0 }, VectorN{ 0, 5, 0, 0 } };
+	CHECK_MESSAGE(PlaneND::from_points(coplanar).is_null(), "PlaneND from_points should not give a hyperplane for points in a 2D plane of 4D space.");
+	CHECK(OrthonormalizedTestPlaneND::_from_points_orthonormalized(coplanar).is_null());
+}
 } // namespace TestPlaneND
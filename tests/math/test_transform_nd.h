@@ -143,6 +143,61 @@ TEST_CASE("[TransformND] Inverse Basis") {
 	CHECK_MESSAGE(test->inverse_basis()->is_equal_approx(precomputed_inverse), "TransformND inverse_basis of rotated matrix should match precomputed inverse.");
 }
 
+TEST_CASE("[TransformND] Fixed dimension fast paths match the general path") {
+	// Dimensions 2 through 6 use FixedMatrixND, 7 and above use the general path. Embedding a 4D
+	// transform in 7D with identity padding must not change its determinant, inverse, or composition.
+	Ref<TransformND> transform_4d = TransformND::from_rotation(0, 3, 0.3)->compose_square(TransformND::from_rotation(1, 2, -1.1));
+	transform_4d = transform_4d->compose_square(TransformND::from_scale(VectorN{ 2, 3, 0.5, 4 }));
+	transform_4d->set_origin(VectorN{ 1, 2, 3, 4 });
+	const Ref<TransformND> transform_7d = transform_4d->with_dimension(7);
+	CHECK_MESSAGE(Math::is_equal_approx(transform_4d->determinant(), 12.0), "TransformND 4D determinant should match the product of the scale.");
+	CHECK_MESSAGE(Math::is_equal_approx(transform_4d->determinant(), transform_7d->determinant()), "TransformND 4D determinant should match the general path.");
+	const Ref<TransformND> inverse_4d = transform_4d->inverse();
+	CHECK_MESSAGE(inverse_4d->with_dimension(7)->is_equal_approx(transform_7d->inverse()), "TransformND 4D inverse should match the general path.");
+	Ref<TransformND> identity_4d;
+	identity_4d.instantiate();
+	identity_4d->set_dimension(4);
+	CHECK_MESSAGE(transform_4d->compose_square(inverse_4d)->is_equal_approx(identity_4d), "TransformND 4D transform composed with its inverse should be identity.");
+	const Ref<TransformND> squared_4d = transform_4d->compose_square(transform_4d);
+	CHECK_MESSAGE(squared_4d->with_dimension(7)->is_equal_approx(transform_7d->compose_square(transform_7d)), "TransformND 4D compose_square should match the general path.");
+	const VectorN point = VectorN{ 1, -1, 2, -2 };
+	CHECK_MESSAGE(VectorND::is_equal_approx(VectorND::with_dimension(transform_4d->xform(point), 7), transform_7d->xform(VectorND::with_dimension(point, 7))), "TransformND 4D xform should match the general path.");
+
+	// 5D and 6D use Gauss-Jordan elimination instead of closed forms.
+	const Ref<TransformND> transform_5d = TransformND::from_rotation(1, 4, 0.8)->compose_square(TransformND::from_scale(VectorN{ 1, 2, 3, 4, 5 }));
+	CHECK_MESSAGE(Math::is_equal_approx(transform_5d->determinant(), 120.0), "TransformND 5D determinant should match the product of the scale.");
+	CHECK_MESSAGE(transform_5d->inverse()->with_dimension(7)->is_equal_approx(transform_5d->with_dimension(7)->inverse()), "TransformND 5D inverse should match the general path.");
+}
+
+TEST_CASE("[TransformND] In-place compose and inverse") {
+	Ref<TransformND> parent = TransformND::from_rotation(0, 2, 0.7)->compose_square(TransformND::from_scale(VectorN{ 2, 1, 3 }));
+	parent->set_origin(VectorN{ 1, 2, 3 });
+	Ref<TransformND> child = TransformND::from_rotation(1, 2, -0.4);
+	child->set_origin(VectorN{ -1, 0, 5 });
+	Ref<TransformND> result;
+	result.instantiate();
+	parent->compose_square_into(child, result);
+	CHECK_MESSAGE(result->is_equal_approx(parent->compose_square(child)), "TransformND compose_square_into should match compose_square.");
+	parent->inverse_into(result);
+	CHECK_MESSAGE(result->is_equal_approx(parent->inverse()), "TransformND inverse_into should match inverse.");
+
+	// The result may be one of the inputs, which is how global transforms are accumulated.
+	const Ref<TransformND> expected = parent->compose_square(child);
+	Ref<TransformND> accumulated = parent->duplicate();
+	accumulated->compose_square_into(child, accumulated);
+	CHECK_MESSAGE(accumulated->is_equal_approx(expected), "TransformND compose_square_into should allow the result to alias the parent.");
+	parent->copy_into(accumulated);
+	CHECK_MESSAGE(accumulated->is_equal_approx(parent), "TransformND copy_into should copy the transform.");
+	accumulated->set_origin_element(0, 100.0);
+	CHECK_MESSAGE(Math::is_equal_approx(parent->get_origin_element(0), 1.0), "TransformND copy_into should not share data with the source.");
+
+	// Transforms of mismatched sizes are padded with the identity like compose_square, including the general path above 6D.
+	const Ref<TransformND> child_7d = TransformND::from_position(VectorN{ 0, 0, 0, 0, 0, 0, 7 });
+	parent->compose_square_into(child_7d, result);
+	CHECK_MESSAGE(result->is_equal_approx(parent->compose_square(child_7d)), "TransformND compose_square_into should match compose_square for mismatched dimensions.");
+	CHECK_MESSAGE(result->get_dimension() == 7, "TransformND compose_square_into should expand to the larger dimension.");
+}
+
 TEST_CASE("[TransformND] From Rotation") {
 	const double angle = 0.5;
 	const double cos_angle = Math::cos(angle);
@@ -189,6 +244,25 @@ TEST_CASE("[TransformND] From Scale") {
 	CHECK_MESSAGE(from_scale->is_equal_approx(precomputed), "TransformND from_scale should match precomputed scale matrix.");
 }
 
+TEST_CASE("[TransformND] Xform Many Flat") {
+	// 5D covers both the SIMD lanes and the scalar remainder of the batch kernel.
+	Ref<TransformND> transform = TransformND::from_rotation(0, 3, 0.7)->compose_square(TransformND::from_scale(VectorN{ 2, 3, 4, 5, 6 }));
+	transform->set_origin(VectorN{ 1, -2, 3, -4, 5 });
+	const Vector<VectorN> vertices = { VectorN{ 1, 2, 3, 4, 5 }, VectorN{ -1, 0, 0.5, 0, 2 }, VectorN{ 0, 0, 0, 0, 0 } };
+	const PackedFloat64Array flat = VectorND::flatten_array(vertices, 5);
+	PackedFloat64Array transformed;
+	int out_stride = 0;
+	transform->xform_many_flat(flat, vertices.size(), 5, transformed, out_stride);
+	CHECK_MESSAGE(out_stride == 5, "TransformND xform_many_flat should output the transform's dimension.");
+	const Vector<VectorN> unflattened = VectorND::unflatten_array(transformed, out_stride, vertices.size());
+	const Vector<VectorN> many = transform->xform_many(vertices);
+	for (int i = 0; i < vertices.size(); i++) {
+		const VectorN expected = transform->xform(vertices[i]);
+		CHECK_MESSAGE(VectorND::is_equal_approx(unflattened[i], expected), "TransformND xform_many_flat should match xform for each vertex.");
+		CHECK_MESSAGE(VectorND::is_equal_approx(many[i], expected), "TransformND xform_many should match xform for each vector.");
+	}
+}
+
 TEST_CASE("[TransformND] Xform Rect") {
 	const Ref<RectND> offset_rect = RectND::from_position_size(VectorN{ 5, 5, 5, 5 }, VectorN{ 1, 1, 1, 1 });
 	// An identity transform must leave the rect untouched, including a rect that does not contain the origin.
@@ -234,4 +308,17 @@ TEST_CASE("[TransformND] Xform Rect") {
 	CHECK_MESSAGE(VectorND::is_equal_exact(result->get_position(), VectorN{ 1, 1, 1, 1 }), "TransformND xform_rect should pad a lower-dimensional identity transform to match a higher-dimensional rect.");
 	CHECK_MESSAGE(VectorND::is_equal_exact(result->get_size(), VectorN{ 1, 1, 1, 1 }), "TransformND xform_rect should pad a lower-dimensional identity transform to match a higher-dimensional rect.");
 }
+
+TEST_CASE("[TransformND] Rejected setters do not mark a change") {
+	Ref<TransformND> transform = TransformND::from_scale(VectorN{ 2, 3 });
+	const uint64_t version = transform->get_version();
+	ERR_PRINT_OFF;
+	transform->set_basis(Ref<BasisND>());
+	transform->set_basis_flat_array(VectorN{ 1, 2, 3 });
+	transform->scale_local(VectorN());
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(transform->get_version() == version, "TransformND should only mark a change when a setter modifies the transform.");
+	transform->set_basis_flat_array(VectorN{ 1, 0, 0, 1 });
+	CHECK(transform->get_version() != version);
+}
 } // namespace TestTransformND
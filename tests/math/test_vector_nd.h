@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../../math/inline_vector_nd.h"
 #include "../../math/vector_nd.h"
 
 #include "tests/test_macros.h"
@@ -101,4 +102,23 @@ TEST_CASE("[VectorND] Perpendicular") {
 		CHECK_MESSAGE(VectorND::is_equal_exact(perpendicular, expected), "VectorND perpendicular in N dimensions should return the correct perpendicular vector.");
 	}
 }
+
+TEST_CASE("[VectorND] InlineVectorN matches VectorN helpers") {
+	const VectorN a = { 1, 2, 3 };
+	const VectorN b = { 4, 5, 6, 7, 8 };
+	InlineVectorN inline_sum(a);
+	inline_sum.multiply_scalar_and_add_in_place(b, 2.0);
+	CHECK_MESSAGE(VectorND::is_equal_exact(inline_sum.to_vector_n(), VectorND::add(a, VectorND::multiply_scalar(b, 2.0))), "InlineVectorN multiply_scalar_and_add_in_place should grow and match VectorND add and multiply_scalar.");
+	InlineVectorN inline_lerp;
+	InlineVectorN::lerp(a.ptr(), a.size(), b.ptr(), b.size(), 0.25, inline_lerp);
+	CHECK_MESSAGE(VectorND::is_equal_approx(inline_lerp.to_vector_n(), VectorND::lerp(a, b, 0.25)), "InlineVectorN lerp should match VectorND lerp.");
+	// Dimensions above the inline capacity spill to the heap but must behave the same.
+	const int64_t big_dimension = InlineVectorN::INLINE_CAPACITY * 2 + 1;
+	const VectorN big = VectorND::fill(big_dimension, 3.0);
+	InlineVectorN inline_big(a);
+	inline_big.add_in_place(big);
+	CHECK_MESSAGE(VectorND::is_equal_exact(inline_big.to_vector_n(), VectorND::add(a, big)), "InlineVectorN should support dimensions above its inline capacity.");
+	const InlineVectorN inline_big_copy = inline_big;
+	CHECK_MESSAGE(Math::is_equal_approx(inline_big_copy.length(), VectorND::length(VectorND::add(a, big))), "InlineVectorN copies should preserve heap-allocated components.");
+}
 } // namespace TestVectorND
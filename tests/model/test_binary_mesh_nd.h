@@ -0,0 +1,144 @@
+#pragma once
+
+#include "../../math/vector_nd.h"
+#include "../../model/mesh/binary_mesh_nd.h"
+#include "../../model/mesh/cell/array_cell_mesh_nd.h"
+#include "../../model/mesh/cell/cell_material_nd.h"
+#include "../../model/mesh/wire/array_wire_mesh_nd.h"
+#include "../../model/mesh/wire/wire_mesh_nd.h"
+#include "../../model/mesh/wire/wire_material_nd.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBinaryMeshND {
+// Reports more vertices than its flat vertex array holds, like a script mesh whose vertices changed between calls.
+class MismatchedVerticesTestWireMeshND : public WireMeshND {
+public:
+	PackedFloat64Array vertices_flat;
+	virtual PackedFloat64Array get_vertices_flat() override { return vertices_flat; }
+	virtual int64_t get_vertex_count() override { return 1000; }
+	virtual int get_vertex_stride() override { return 3; }
+	virtual PackedInt32Array get_edge_indices() override { return PackedInt32Array{ 0, 1 }; }
+};
+
+TEST_CASE("[BinaryMeshND] Cell mesh round trip") {
+	Ref<ArrayCellMeshND> cell_mesh;
+	cell_mesh.instantiate();
+	cell_mesh->set_vertices(Vector<VectorN>{ VectorN{ 0, 0, 0, 0 }, VectorN{ 1, 0, 0, 0 }, VectorN{ 0, 1, 0, 0 }, VectorN{ 0, 0, 1, 0 }, VectorN{ 0, 0, 0, 1 } });
+	cell_mesh->set_simplex_cell_indices(PackedInt32Array{ 0, 1, 2, 3, 0, 1, 2, 4 });
+	cell_mesh->set_cell_boundary_normals(Vector<VectorN>{ VectorN{ 0, 0, 0, -1 }, VectorN{ 0, 0, -1 } });
+	cell_mesh->set_name("pentachoron_part.off");
+	Ref<CellMaterialND> cell_material;
+	cell_material.instantiate();
+	cell_material->set_albedo_source_flags(MaterialND::COLOR_SOURCE_FLAG_PER_CELL);
+	cell_material->set_albedo_color_array(PackedColorArray{ Color(1, 0, 0), Color(0, 0.5, 1, 0.25) });
+	cell_mesh->set_material(cell_material);
+
+	const PackedByteArray bytes = BinaryMeshND::save_to_byte_array(cell_mesh);
+	REQUIRE_FALSE(bytes.is_empty());
+	Error err = FAILED;
+	const Ref<ArrayCellMeshND> loaded = BinaryMeshND::load_from_byte_array(bytes, &err);
+	CHECK(err == OK);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "pentachoron_part.off");
+	CHECK(loaded->get_vertex_count() == 5);
+	CHECK(loaded->get_vertex_stride() == 4);
+	CHECK(loaded->get_vertices_flat() == cell_mesh->get_vertices_flat());
+	CHECK(loaded->get_simplex_cell_indices() == cell_mesh->get_simplex_cell_indices());
+	CHECK(loaded->get_edge_indices() == cell_mesh->get_edge_indices());
+	const Vector<VectorN> boundary_normals = loaded->get_simplex_cell_boundary_normals();
+	REQUIRE(boundary_normals.size() == 2);
+	// Normals are stored with the vertex stride, so shorter ones get padded with zeros.
+	CHECK(VectorND::is_equal_exact(boundary_normals[1], VectorN{ 0, 0, -1, 0 }));
+	CHECK(loaded->is_mesh_data_valid());
+	const Ref<CellMaterialND> loaded_material = loaded->get_material();
+	REQUIRE(loaded_material.is_valid());
+	CHECK(loaded_material->get_albedo_source_flags() == MaterialND::COLOR_SOURCE_FLAG_PER_CELL);
+	CHECK(loaded_material->get_albedo_color_array() == cell_material->get_albedo_color_array());
+}
+
+TEST_CASE("[BinaryMeshND] Wire mesh round trip and corrupt data") {
+	Ref<ArrayWireMeshND> wire_mesh;
+	wire_mesh.instantiate();
+	wire_mesh->append_edge_points(VectorN{ 0, 0, 0 }, VectorN{ 1, 2, 3 });
+	wire_mesh->append_edge_points(VectorN{ 1, 2, 3 }, VectorN{ -1, 0.5, 0 });
+	Ref<WireMaterialND> wire_material;
+	wire_material.instantiate();
+	wire_material->set_albedo_source(WireMaterialND::WIRE_COLOR_SOURCE_PER_EDGE_AND_SINGLE);
+	wire_material->set_albedo_color(Color(0, 1, 0));
+	wire_material->set_albedo_color_array(PackedColorArray{ Color(1, 1, 0), Color(0, 1, 1) });
+	wire_material->set_line_thickness(2.0);
+	wire_mesh->set_material(wire_material);
+
+	PackedByteArray bytes = BinaryMeshND::save_to_byte_array(wire_mesh);
+	const Ref<ArrayWireMeshND> loaded = BinaryMeshND::load_from_byte_array(bytes);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_vertices_flat() == wire_mesh->get_vertices_flat());
+	CHECK(loaded->get_edge_indices() == PackedInt32Array{ 0, 1, 1, 2 });
+	const Ref<WireMaterialND> loaded_material = loaded->get_material();
+	REQUIRE(loaded_material.is_valid());
+	CHECK(loaded_material->get_albedo_source() == WireMaterialND::WIRE_COLOR_SOURCE_PER_EDGE_AND_SINGLE);
+	CHECK(loaded_material->get_albedo_color() == Color(0, 1, 0));
+	CHECK(loaded_material->get_albedo_color_array() == wire_material->get_albedo_color_array());
+	CHECK(loaded_material->get_line_thickness() == doctest::Approx(2.0));
+
+	// Truncated data must fail cleanly instead of reading past the end.
+	ERR_PRINT_OFF;
+	bytes.resize(bytes.size() - 4);
+	Error err = OK;
+	CHECK(BinaryMeshND::load_from_byte_array(bytes, &err).is_null());
+	CHECK(err == ERR_FILE_CORRUPT);
+	CHECK(BinaryMeshND::load_from_byte_array(PackedByteArray{ 'N', 'D' }).is_null());
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[BinaryMeshND] Quantized vertices") {
+	Ref<ArrayWireMeshND> wire_mesh;
+	wire_mesh.instantiate();
+	// Far from the origin, where float16 alone could only represent steps of 0.0625.
+	wire_mesh->append_edge_points(VectorN{ 100, 100.25, 101, 100 }, VectorN{ 100.7, 100, 100.3, 100 });
+	wire_mesh->append_edge_points(VectorN{ 100.7, 100, 100.3, 100 }, VectorN{ 101, 101, 100, 100 });
+	const PackedFloat64Array original = wire_mesh->get_vertices_flat();
+
+	BinaryMeshND::QuantizationReport report;
+	const PackedByteArray float16_bytes = BinaryMeshND::save_to_byte_array(wire_mesh, BinaryMeshND::ENCODING_FLOAT16, &report);
+	CHECK(report.byte_count == float16_bytes.size());
+	CHECK(report.byte_count < report.unquantized_byte_count);
+	CHECK(report.unquantized_byte_count == BinaryMeshND::save_to_byte_array(wire_mesh).size());
+	CHECK(report.max_vertex_error < 0.001);
+	CHECK(report.rms_vertex_error <= report.max_vertex_error);
+	const Ref<ArrayWireMeshND> float16_loaded = BinaryMeshND::load_from_byte_array(float16_bytes);
+	REQUIRE(float16_loaded.is_valid());
+	const PackedFloat64Array float16_vertices = float16_loaded->get_vertices_flat();
+	REQUIRE(float16_vertices.size() == original.size());
+	for (int64_t i = 0; i < original.size(); i++) {
+		CHECK(Math::abs(float16_vertices[i] - original[i]) < 0.001);
+	}
+	// The axis where every vertex has the same value is stored exactly.
+	CHECK(float16_vertices[3] == 100.0);
+
+	const PackedByteArray float8_bytes = BinaryMeshND::save_to_byte_array(wire_mesh, BinaryMeshND::ENCODING_FLOAT8, &report);
+	CHECK(float8_bytes.size() < float16_bytes.size());
+	CHECK(report.max_vertex_error < 0.1);
+	const Ref<ArrayWireMeshND> float8_loaded = BinaryMeshND::load_from_byte_array(float8_bytes);
+	REQUIRE(float8_loaded.is_valid());
+	// The corners of the bounds are exactly representable.
+	CHECK(float8_loaded->get_vertices_flat()[0] == 100.0);
+	CHECK(float8_loaded->get_vertices_flat()[2] == 101.0);
+}
+
+TEST_CASE("[BinaryMeshND] Vertex count is taken from the saved vertices") {
+	Ref<MismatchedVerticesTestWireMeshND> wire_mesh = memnew(MismatchedVerticesTestWireMeshND);
+	wire_mesh->vertices_flat = PackedFloat64Array{ 0, 0, 0, 1, 2, 3 };
+	const PackedByteArray bytes = BinaryMeshND::save_to_byte_array(wire_mesh);
+	const Ref<ArrayWireMeshND> loaded = BinaryMeshND::load_from_byte_array(bytes);
+	REQUIRE(loaded.is_valid());
+	CHECK_MESSAGE(loaded->get_vertex_count() == 2, "BinaryMeshND should save the vertices in the flat array, not trust get_vertex_count.");
+	CHECK(loaded->get_vertices_flat() == wire_mesh->vertices_flat);
+	// A flat array that is not a multiple of the stride cannot be saved.
+	wire_mesh->vertices_flat = PackedFloat64Array{ 0, 0, 0, 1 };
+	ERR_PRINT_OFF;
+	CHECK(BinaryMeshND::save_to_byte_array(wire_mesh).is_empty());
+	ERR_PRINT_ON;
+}
+} // namespace TestBinaryMeshND
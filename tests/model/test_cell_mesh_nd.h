@@ -1,7 +1,9 @@
 #pragma once
 
+#include "../../math/plane_nd.h"
 #include "../../model/mesh/cell/array_cell_mesh_nd.h"
 #include "../../model/mesh/cell/box_cell_mesh_nd.h"
+#include "../../model/mesh/cell/cell_material_nd.h"
 #include "../../model/mesh/cell/orthoplex_cell_mesh_nd.h"
 
 #include "tests/test_macros.h"
@@ -44,7 +46,13 @@ TEST_CASE("[CellMeshND] Decompose Box Polytope Cell into Simplexes") {
 	vertices.append(VectorN{ 1, 1, 1 });
 	cell_indices = { 0, 1, 2, 3, 4, 5, 6, 7 };
 	decomposed = CellMeshND::decompose_polytope_cell_into_simplexes(vertices, cell_indices, 3, -1, Vector<VectorN>());
-	CHECK(decomposed.size() == 6);
+	REQUIRE(decomposed.size() == 6);
+	CHECK(decomposed[0] == PackedInt32Array{ 0, 1, 3, 7 });
+	CHECK(decomposed[1] == PackedInt32Array{ 0, 1, 5, 7 });
+	CHECK(decomposed[2] == PackedInt32Array{ 0, 2, 3, 7 });
+	CHECK(decomposed[3] == PackedInt32Array{ 0, 2, 6, 7 });
+	CHECK(decomposed[4] == PackedInt32Array{ 0, 4, 5, 7 });
+	CHECK(decomposed[5] == PackedInt32Array{ 0, 4, 6, 7 });
 	// 4D case.
 	vertices.clear();
 	vertices.append(VectorN{ 0, 0, 0, 0 });
@@ -103,8 +111,210 @@ TEST_CASE("[CellMeshND] Decompose Box Polytope Cell into Simplexes") {
 	cell_indices = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31 };
 	decomposed = CellMeshND::decompose_polytope_cell_into_simplexes(vertices, cell_indices, 5, -1, Vector<VectorN>());
 	CHECK(decomposed.size() == 120);
-	// Note: Due to the nature of polytopes, this algorithm has O(2^n) complexity.
-	// A test with 6D would take many minutes to run... so is omitted for sanity.
-	// I am sure a better algorithm exists, but this technically works for now.
+	// 6D case, the box has 2^6 vertices which used to make this take many minutes.
+	vertices.clear();
+	cell_indices.clear();
+	for (int i = 0; i < 64; i++) {
+		VectorN vertex;
+		for (int axis = 0; axis < 6; axis++) {
+			vertex.append((i >> axis) & 1);
+		}
+		vertices.append(vertex);
+		cell_indices.append(i);
+	}
+	decomposed = CellMeshND::decompose_polytope_cell_into_simplexes(vertices, cell_indices, 6, -1, Vector<VectorN>());
+	CHECK(decomposed.size() == 720);
+}
+
+TEST_CASE("[CellMeshND] Decompose Dodecahedron Polytope Cell into Simplexes") {
+	// The cells of the 120-cell are dodecahedrons, which have 20 vertices and 12 pentagonal faces.
+	const double phi = (1.0 + Math::sqrt(5.0)) / 2.0;
+	const double inv_phi = 1.0 / phi;
+	Vector<VectorN> vertices;
+	for (int i = 0; i < 8; i++) {
+		vertices.append(VectorN{ (i & 1) ? 1.0 : -1.0, (i & 2) ? 1.0 : -1.0, (i & 4) ? 1.0 : -1.0 });
+	}
+	for (int i = 0; i < 4; i++) {
+		const double a = (i & 1) ? inv_phi : -inv_phi;
+		const double b = (i & 2) ? phi : -phi;
+		vertices.append(VectorN{ 0.0, a, b });
+		vertices.append(VectorN{ a, b, 0.0 });
+		vertices.append(VectorN{ b, 0.0, a });
+	}
+	PackedInt32Array cell_indices;
+	for (int i = 0; i < vertices.size(); i++) {
+		cell_indices.append(i);
+	}
+	// Pinned to the faces and order found by testing every combination of vertices.
+	const Vector<PackedInt32Array> expected_simplexes = {
+		PackedInt32Array{ 0, 1, 3, 11 },
+		PackedInt32Array{ 0, 1, 3, 16 },
+		PackedInt32Array{ 0, 1, 8, 11 },
+		PackedInt32Array{ 0, 1, 5, 12 },
+		PackedInt32Array{ 0, 1, 5, 19 },
+		PackedInt32Array{ 0, 1, 16, 19 },
+		PackedInt32Array{ 0, 2, 3, 11 },
+		PackedInt32Array{ 0, 2, 3, 18 },
+		PackedInt32Array{ 0, 2, 15, 18 },
+		PackedInt32Array{ 0, 2, 6, 13 },
+		PackedInt32Array{ 0, 2, 6, 15 },
+		PackedInt32Array{ 0, 2, 10, 13 },
+		PackedInt32Array{ 0, 3, 7, 18 },
+		PackedInt32Array{ 0, 3, 7, 19 },
+		PackedInt32Array{ 0, 3, 16, 19 },
+		PackedInt32Array{ 0, 4, 5, 12 },
+		PackedInt32Array{ 0, 4, 5, 14 },
+		PackedInt32Array{ 0, 4, 9, 12 },
+		PackedInt32Array{ 0, 4, 6, 13 },
+		PackedInt32Array{ 0, 4, 6, 17 },
+		PackedInt32Array{ 0, 4, 14, 17 },
+		PackedInt32Array{ 0, 5, 7, 17 },
+		PackedInt32Array{ 0, 5, 7, 19 },
+		PackedInt32Array{ 0, 5, 14, 17 },
+		PackedInt32Array{ 0, 6, 7, 17 },
+		PackedInt32Array{ 0, 6, 7, 18 },
+		PackedInt32Array{ 0, 6, 15, 18 },
+	};
+	Vector<PackedInt32Array> decomposed = CellMeshND::decompose_polytope_cell_into_simplexes(vertices, cell_indices, 3, -1, Vector<VectorN>());
+	// The pivot is on 3 of the pentagons, and each of the other 9 is split into 3 triangles.
+	REQUIRE(decomposed.size() == 27);
+	for (int i = 0; i < expected_simplexes.size(); i++) {
+		CHECK(decomposed[i] == expected_simplexes[i]);
+	}
+	// The same cell inside of a 4D space, as it would be in the 120-cell.
+	for (int i = 0; i < vertices.size(); i++) {
+		vertices.set(i, VectorN{ vertices[i][0], vertices[i][1], vertices[i][2], 2.0 });
+	}
+	decomposed = CellMeshND::decompose_polytope_cell_into_simplexes(vertices, cell_indices, 3, -1, Vector<VectorN>());
+	REQUIRE(decomposed.size() == 27);
+	for (int i = 0; i < expected_simplexes.size(); i++) {
+		CHECK(decomposed[i] == expected_simplexes[i]);
+	}
+}
+
+TEST_CASE("[CellMeshND] Edge to cell adjacency and per-cell edge colors") {
+	Ref<ArrayCellMeshND> mesh;
+	mesh.instantiate();
+	Vector<VectorN> vertices;
+	vertices.append(VectorN{ 0, 0, 0 });
+	vertices.append(VectorN{ 1, 0, 0 });
+	vertices.append(VectorN{ 0, 1, 0 });
+	vertices.append(VectorN{ 0, 0, 1 });
+	mesh->set_vertices(vertices);
+	// Two triangles sharing the edge between vertices 0 and 2.
+	mesh->set_simplex_cell_indices(PackedInt32Array{ 0, 1, 2, 0, 2, 3 });
+	const PackedInt32Array edge_indices = mesh->get_edge_indices();
+	const int64_t edge_count = edge_indices.size() / 2;
+	CHECK(edge_count == 5);
+	Ref<CellMaterialND> material;
+	material.instantiate();
+	material->set_albedo_source_flags(MaterialND::COLOR_SOURCE_FLAG_PER_CELL);
+	material->set_albedo_color_array(PackedColorArray{ Color(1, 0, 0), Color(0, 0, 1) });
+	for (int64_t i = 0; i < edge_count; i++) {
+		const int32_t a = MIN(edge_indices[i * 2], edge_indices[i * 2 + 1]);
+		const int32_t b = MAX(edge_indices[i * 2], edge_indices[i * 2 + 1]);
+		const PackedInt32Array cells = mesh->get_cells_of_edge(i);
+		const Color edge_color = material->get_albedo_color_of_edge(i, mesh);
+		if (a == 0 && b == 2) {
+			CHECK(cells == PackedInt32Array{ 0, 1 });
+			CHECK(edge_color.is_equal_approx(Color(0.5, 0, 0.5)));
+		} else if (b == 1 || (a == 1 && b == 2)) {
+			CHECK(cells == PackedInt32Array{ 0 });
+			CHECK(edge_color.is_equal_approx(Color(1, 0, 0)));
+		} else {
+			CHECK(cells == PackedInt32Array{ 1 });
+			CHECK(edge_color.is_equal_approx(Color(0, 0, 1)));
+		}
+	}
+	// Changing the cells must rebuild the adjacency.
+	mesh->set_simplex_cell_indices(PackedInt32Array{ 0, 1, 2 });
+	CHECK(mesh->get_edge_indices().size() == 6);
+	for (int64_t i = 0; i < 3; i++) {
+		CHECK(mesh->get_cells_of_edge(i) == PackedInt32Array{ 0 });
+	}
+	// Custom edges may list the same edge more than once, in either direction, and every copy has the cells.
+	mesh->set_simplex_cell_indices(PackedInt32Array{ 0, 1, 2, 0, 2, 3 });
+	mesh->set_edge_indices_cache(PackedInt32Array{ 0, 2, 1, 2, 2, 0, 0, 2 });
+	CHECK(mesh->get_cells_of_edge(0) == PackedInt32Array{ 0, 1 });
+	CHECK(mesh->get_cells_of_edge(1) == PackedInt32Array{ 0 });
+	CHECK_MESSAGE(mesh->get_cells_of_edge(2) == PackedInt32Array{ 0, 1 }, "CellMeshND should give a repeated edge the cells of the edge.");
+	CHECK(mesh->get_cells_of_edge(3) == PackedInt32Array{ 0, 1 });
+	CHECK(material->get_albedo_color_of_edge(3, mesh).is_equal_approx(Color(0.5, 0, 0.5)));
+}
+
+TEST_CASE("[CellMeshND] Box Surface Simplexes and Streaming") {
+	Ref<BoxCellMeshND> box;
+	box.instantiate();
+	box->set_size(VectorN{ 2, 2, 2 });
+	CHECK(box->get_simplex_cell_count() == 6);
+	CHECK(box->get_simplex_cell_indices().size() == 6 * 4);
+	// The surface of a 3D box is 6 squares split into 2 triangles each, all facing outward.
+	box->set_surface_only(true);
+	CHECK(box->get_indices_per_simplex_cell() == 3);
+	CHECK(box->get_simplex_cell_count() == 12);
+	const PackedInt32Array surface_indices = box->get_simplex_cell_indices();
+	CHECK(surface_indices.size() == 12 * 3);
+	const Vector<VectorN> box_vertices = box->get_vertices();
+	for (int64_t i = 0; i < 12; i++) {
+		const Ref<PlaneND> plane = PlaneND::from_points(Vector<VectorN>{ box_vertices[surface_indices[i * 3]], box_vertices[surface_indices[i * 3 + 1]], box_vertices[surface_indices[i * 3 + 2]] });
+		REQUIRE(plane.is_valid());
+		CHECK(Math::is_equal_approx(plane->get_distance(), 1.0));
+	}
+	CHECK(box->get_edge_indices().size() == 18 * 2);
+	// Ranges of cells match the stored cells.
+	box->set_size(VectorN{ 1, 2, 3, 4 });
+	for (const bool surface_only : { false, true }) {
+		box->set_surface_only(surface_only);
+		const PackedInt32Array all_indices = box->get_simplex_cell_indices();
+		const int64_t indices_per_cell = box->get_indices_per_simplex_cell();
+		CHECK(all_indices.size() == box->get_simplex_cell_count() * indices_per_cell);
+		const PackedInt32Array range = box->get_simplex_cell_indices_range(5, 10);
+		CHECK(range == all_indices.slice(5 * indices_per_cell, 15 * indices_per_cell));
+		CHECK(box->get_simplex_cell_indices_range(box->get_simplex_cell_count() - 1, 10).size() == indices_per_cell);
+	}
+	// A 12D box has too many cells to store, but they can still be streamed.
+	box->set_dimension(12);
+	CHECK(box->get_dimension() == 12);
+	CHECK(box->get_simplex_cell_count() == 2 * 479001600);
+	BoxCellSimplexCursorND cursor = box->get_simplex_cell_cursor();
+	int32_t indices[12];
+	REQUIRE(cursor.seek(box->get_simplex_cell_count() - 1));
+	CHECK(cursor.next(indices));
+	CHECK(!cursor.next(indices));
+	// The last simplex is on the positive side of the last axis.
+	for (int i = 0; i < 12; i++) {
+		CHECK((indices[i] & (1 << 11)) != 0);
+	}
+	CHECK(box->get_simplex_cell_indices_range(1000, 2).size() == 2 * 12);
+}
+
+TEST_CASE("[CellMeshND] Box per-cell colors") {
+	Ref<BoxCellMeshND> box;
+	box.instantiate();
+	box->set_size(VectorN{ 2, 2, 2 });
+	box->set_surface_only(true);
+	Ref<CellMaterialND> material;
+	material.instantiate();
+	material->set_albedo_source_flags(MaterialND::COLOR_SOURCE_FLAG_PER_CELL);
+	box->validate_material_for_mesh(material);
+	// One color for each of the 12 surface triangles, not one for every dimension + 1 indices.
+	CHECK(material->get_albedo_color_array().size() == 12);
+	PackedColorArray cell_colors;
+	for (int i = 0; i < 12; i++) {
+		cell_colors.append(i < 6 ? Color(1, 0, 0) : Color(0, 0, 1));
+	}
+	material->set_albedo_color_array(cell_colors);
+	PackedColorArray edge_colors;
+	material->get_albedo_colors_of_edges(box, edge_colors);
+	CHECK(edge_colors.size() == 18);
+	// Boxes with too many cells to store use the albedo color for every edge, instead of failing.
+	box->set_dimension(11);
+	material->set_albedo_color(Color(0, 1, 0));
+	ERR_PRINT_OFF;
+	box->validate_material_for_mesh(material);
+	ERR_PRINT_ON;
+	CHECK(material->get_albedo_color_array().size() == 12);
+	CHECK(material->get_albedo_color_of_edge(0, box).is_equal_approx(Color(0, 1, 0)));
+	CHECK(box->get_cells_of_edge(0).is_empty());
 }
 } // namespace TestCellMeshND
@@ -6,6 +6,16 @@
 #include "tests/test_macros.h"
 
 namespace TestMeshND {
+// Reports a vertex count that does not match its flat vertices, like a script mesh whose vertices changed between calls.
+class MismatchedVerticesTestMeshND : public MeshND {
+public:
+	PackedFloat64Array vertices_flat;
+	virtual PackedFloat64Array get_vertices_flat() override { return vertices_flat; }
+	virtual int64_t get_vertex_count() override { return 100; }
+	virtual int get_vertex_stride() override { return 2; }
+	virtual PackedInt32Array get_edge_indices() override { return PackedInt32Array{ 0, 1 }; }
+};
+
 TEST_CASE("[MeshND] Rect bounds include the local origin") {
 	Ref<ArrayWireMeshND> mesh;
 	mesh.instantiate();
@@ -85,4 +95,29 @@ TEST_CASE("[MeshND] Bounds cache persists across multiple accesses") {
 	CHECK(bounds_after_change != bounds1);
 	CHECK(VectorND::is_equal_exact(bounds_after_change->get_end(), VectorN{ 1, 1, 1, 1 }));
 }
+
+TEST_CASE("[MeshND] Vertex count is derived from the flat vertices") {
+	Ref<MismatchedVerticesTestMeshND> mesh = memnew(MismatchedVerticesTestMeshND);
+	mesh->vertices_flat = PackedFloat64Array{ 1, 2, 3, 4 };
+	PackedFloat64Array vertices_flat;
+	int64_t vertex_count = 0;
+	int stride = 0;
+	CHECK(mesh->get_vertices_flat_checked(vertices_flat, vertex_count, stride));
+	CHECK_MESSAGE(vertex_count == 2, "MeshND should count the vertices in the flat array, not trust get_vertex_count.");
+	CHECK(stride == 2);
+	const Vector<VectorN> edge_positions = mesh->get_edge_positions();
+	REQUIRE(edge_positions.size() == 2);
+	CHECK(VectorND::is_equal_exact(edge_positions[1], VectorN{ 3, 4 }));
+	CHECK(VectorND::is_equal_exact(mesh->get_rect_bounds()->get_end(), VectorN{ 3, 4 }));
+	// A flat array that is not a multiple of the stride has no usable vertices.
+	Ref<MismatchedVerticesTestMeshND> broken_mesh = memnew(MismatchedVerticesTestMeshND);
+	broken_mesh->vertices_flat = PackedFloat64Array{ 1, 2, 3 };
+	ERR_PRINT_OFF;
+	CHECK_FALSE(broken_mesh->get_vertices_flat_checked(vertices_flat, vertex_count, stride));
+	CHECK(vertex_count == 0);
+	CHECK(broken_mesh->get_edge_positions().is_empty());
+	const Ref<RectND> broken_bounds = broken_mesh->get_rect_bounds();
+	ERR_PRINT_ON;
+	CHECK(VectorND::is_equal_exact(broken_bounds->get_end(), VectorN{ 0, 0 }));
+}
 } // namespace TestMeshND
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "../../math/vector_nd.h"
+#include "../../model/off/off_document_nd.h"
+
+#include "tests/test_macros.h"
+
+namespace TestOFFDocumentND {
+const String CUBE_OFF = "OFF\n"
+						"8 6 12\n"
+						"# Vertices\n"
+						"0 0 0\n1 0 0\n0 1 0\n1 1 0\n0 0 1\n1 0 1\n0 1 1\n1 1 1\n"
+						"# Faces\n"
+						"4 0 2 3 1 255 0 0\n4 4 5 7 6\n4 0 1 5 4\n4 2 6 7 3\n4 0 4 6 2\n4 1 3 7 5\n";
+
+const String PENTACHORON_OFF = "4OFF\r\n"
+								   "# Pentachoron with CRLF line endings, tabs, and trailing comments.\r\n"
+								   "5 10 10 5\r\n"
+								   "0 0 0 0\r\n"
+								   "1 0 0 0\r\n"
+								   "0 1 0 0\r\n"
+								   "0 0 1 0\r\n"
+								   "0.5\t0.25 -1e-3 2.5E1 # Trailing comment.\r\n"
+								   "3 0 1 2\r\n"
+								   "3 0 1 3\r\n"
+								   "3 0 1 4\r\n"
+								   "3 0 2 3\r\n"
+								   "3 0 2 4\r\n"
+								   "3 0 3 4\r\n"
+								   "3 1 2 3\r\n"
+								   "3 1 2 4\r\n"
+								   "3 1 3 4\r\n"
+								   "3 2 3 4\r\n"
+								   "4 6 7 8 9 0 255 0\r\n"
+								   "4 3 4 5 9\r\n"
+								   "4 1 2 5 8\r\n"
+								   "4 0 2 4 7\r\n"
+								   "4 0 1 3 6\r\n";
+
+TEST_CASE("[OFFDocumentND] Import cube and generate wire mesh") {
+	Ref<OFFDocumentND> off_document = OFFDocumentND::import_load_from_byte_array(CUBE_OFF.to_utf8_buffer());
+	REQUIRE(off_document.is_valid());
+	CHECK(off_document->get_vertices().size() == 8);
+	CHECK(off_document->get_edge_count() == 12);
+	Ref<ArrayWireMeshND> wire_mesh = off_document->import_generate_wire_mesh_nd(true);
+	const PackedInt32Array edge_indices = wire_mesh->get_edge_indices();
+	CHECK(edge_indices.size() == 24);
+	// Edges are stored with the lower index first, in the order they first appear in the faces.
+	CHECK(edge_indices[0] == 0);
+	CHECK(edge_indices[1] == 2);
+	CHECK(edge_indices[2] == 2);
+	CHECK(edge_indices[3] == 3);
+	// The edges of the first face get its color, the rest are white.
+	const Ref<MaterialND> material = wire_mesh->get_material();
+	REQUIRE(material.is_valid());
+	const PackedColorArray edge_colors = material->get_albedo_color_array();
+	CHECK(edge_colors.size() == 12);
+	CHECK(edge_colors[0] == Color(1, 0, 0));
+	CHECK(edge_colors[4] == Color(1, 1, 1));
+	// Without deduplication, every face contributes all of its edges.
+	CHECK(off_document->import_generate_wire_mesh_nd(false)->get_edge_indices().size() == 48);
+}
+
+TEST_CASE("[OFFDocumentND] Export counts unique edges") {
+	Ref<OFFDocumentND> off_document = OFFDocumentND::import_load_from_byte_array(CUBE_OFF.to_utf8_buffer());
+	REQUIRE(off_document.is_valid());
+	off_document->set_edge_count(0);
+	const String exported = off_document->export_save_to_byte_array().get_string_from_utf8();
+	CHECK(exported.begins_with("OFF\n8 6 12\n"));
+}
+
+TEST_CASE("[OFFDocumentND] Import 4D with CRLF, tabs, and trailing comments") {
+	ERR_PRINT_OFF;
+	Ref<OFFDocumentND> off_document = OFFDocumentND::import_load_from_byte_array(PENTACHORON_OFF.to_utf8_buffer());
+	ERR_PRINT_ON;
+	REQUIRE(off_document.is_valid());
+	const Vector<VectorN> vertices = off_document->get_vertices();
+	REQUIRE(vertices.size() == 5);
+	CHECK(VectorND::is_equal_exact(vertices[1], VectorN{ 1, 0, 0, 0 }));
+	CHECK(VectorND::is_equal_exact(vertices[4], VectorN{ 0.5, 0.25, -0.001, 25.0 }));
+	const Vector<Vector<PackedInt32Array>> cell_face_indices = off_document->get_cell_face_indices();
+	REQUIRE(cell_face_indices.size() == 2);
+	CHECK(cell_face_indices[0].size() == 10);
+	CHECK(cell_face_indices[0][9] == PackedInt32Array{ 2, 3, 4 });
+	REQUIRE(cell_face_indices[1].size() == 5);
+	CHECK(cell_face_indices[1][0] == PackedInt32Array{ 6, 7, 8, 9 });
+	CHECK(cell_face_indices[1][4] == PackedInt32Array{ 0, 1, 3, 6 });
+	const Vector<PackedColorArray> cell_colors = off_document->get_cell_colors();
+	REQUIRE(cell_colors.size() == 2);
+	CHECK(cell_colors[1][0] == Color(0, 1, 0));
+	CHECK(cell_colors[1][1] == Color(1, 1, 1));
+}
+
+TEST_CASE("[OFFDocumentND] Parallel import matches serial import") {
+	// Enough lines to split the body into several chunks, with comments and blank lines in between.
+	const int vertex_count = 20000;
+	String off_text = "4OFF\n" + itos(vertex_count) + " " + itos(vertex_count - 2) + " 0 1\n";
+	for (int i = 0; i < vertex_count; i++) {
+		off_text += itos(i) + " " + String::num(i * 0.25) + " -" + itos(i % 7) + " 1e-3\n";
+		if (i % 1000 == 0) {
+			off_text += "# Comment\n\n";
+		}
+	}
+	for (int i = 0; i < vertex_count - 2; i++) {
+		off_text += "3 " + itos(i) + " " + itos(i + 1) + " " + itos(i + 2) + (i % 3 == 0 ? " 255 128 0\n" : "\n");
+	}
+	off_text += "4 0 1 2 3";
+	const PackedByteArray off_bytes = off_text.to_utf8_buffer();
+	Ref<OFFDocumentND> serial = OFFDocumentND::import_load_from_byte_array(off_bytes);
+	Ref<OFFDocumentND> parallel = OFFDocumentND::import_load_from_byte_array_parallel(off_bytes);
+	REQUIRE(serial.is_valid());
+	REQUIRE(parallel.is_valid());
+	const Vector<VectorN> serial_vertices = serial->get_vertices();
+	const Vector<VectorN> parallel_vertices = parallel->get_vertices();
+	REQUIRE(parallel_vertices.size() == vertex_count);
+	bool vertices_match = true;
+	for (int i = 0; i < vertex_count; i++) {
+		vertices_match = vertices_match && VectorND::is_equal_exact(serial_vertices[i], parallel_vertices[i]);
+	}
+	CHECK(vertices_match);
+	CHECK(parallel->get_cell_face_indices() == serial->get_cell_face_indices());
+	CHECK(parallel->get_cell_colors() == serial->get_cell_colors());
+	const Vector<Vector<PackedInt32Array>> cell_face_indices = parallel->get_cell_face_indices();
+	REQUIRE(cell_face_indices.size() == 2);
+	CHECK(cell_face_indices[0].size() == vertex_count - 2);
+	CHECK(cell_face_indices[1][0] == PackedInt32Array{ 0, 1, 2, 3 });
+}
+} // namespace TestOFFDocumentND
@@ -38,6 +38,40 @@ TEST_CASE("[ArrayWireMeshND] Append Edge Points") {
 	}
 }
 
+TEST_CASE("[ArrayWireMeshND] Flat vertex storage pads to the widest vertex") {
+	Ref<ArrayWireMeshND> array_wire_mesh;
+	array_wire_mesh.instantiate();
+	array_wire_mesh->append_vertex(VectorN{ 1, 2 });
+	array_wire_mesh->append_vertex(VectorN{ 3, 4, 5 });
+	// A shorter vertex that matches an existing one with trailing zeros is deduplicated.
+	CHECK(array_wire_mesh->append_vertex(VectorN{ 1, 2, 0 }) == 0);
+	CHECK(array_wire_mesh->get_vertex_count() == 2);
+	CHECK(array_wire_mesh->get_vertex_stride() == 3);
+	const PackedFloat64Array correct_flat = { 1, 2, 0, 3, 4, 5 };
+	CHECK(array_wire_mesh->get_vertices_flat() == correct_flat);
+	const Vector<VectorN> correct_vertices = { VectorN{ 1, 2, 0 }, VectorN{ 3, 4, 5 } };
+	CHECK(VectorND::is_equal_exact_array(array_wire_mesh->get_vertices(), correct_vertices));
+	array_wire_mesh->set_dimension(2);
+	const PackedFloat64Array correct_truncated = { 1, 2, 3, 4 };
+	CHECK(array_wire_mesh->get_vertices_flat() == correct_truncated);
+}
+
+TEST_CASE("[ArrayWireMeshND] Vertex deduplication uses approximate equality") {
+	Ref<ArrayWireMeshND> array_wire_mesh;
+	array_wire_mesh.instantiate();
+	for (int i = 0; i < 100; i++) {
+		CHECK(array_wire_mesh->append_vertex(VectorN{ (double)i, 1000.0 + i, -0.5 }) == i);
+	}
+	// Within the tolerance of Math::is_equal_approx, which is relative for components above 1.
+	CHECK(array_wire_mesh->append_vertex(VectorN{ 42.0, 1042.005, -0.500001 }) == 42);
+	CHECK(array_wire_mesh->append_vertex(VectorN{ 42.0, 1042.1, -0.5 }) == 100);
+	// Replacing the vertices must not leave stale entries for deduplication.
+	array_wire_mesh->set_vertices(Vector<VectorN>{ VectorN{ 5, 5 } });
+	CHECK(array_wire_mesh->append_vertex(VectorN{ 0.0, 1000.0, -0.5 }) == 1);
+	CHECK(array_wire_mesh->append_vertex(VectorN{ 5, 5, 0 }) == 0);
+	CHECK(array_wire_mesh->get_vertex_count() == 2);
+}
+
 TEST_CASE("[BoxWireMeshND] Edges and Vertices") {
 	Ref<BoxWireMeshND> box_wire_mesh;
 	box_wire_mesh.instantiate();
@@ -50,6 +84,9 @@ TEST_CASE("[BoxWireMeshND] Edges and Vertices") {
 	CHECK(VectorND::is_equal_exact(box_wire_mesh->get_size(), VectorN{ 1, 2, 3 }));
 	const PackedInt32Array correct_edge_indices = { 0, 1, 0, 2, 0, 4, 1, 3, 1, 5, 2, 3, 2, 6, 3, 7, 4, 5, 4, 6, 5, 7, 6, 7 };
 	CHECK(edge_indices == correct_edge_indices);
+	CHECK(box_wire_mesh->get_vertex_stride() == 3);
+	CHECK(box_wire_mesh->get_vertices_flat().size() == 8 * 3);
+	CHECK(VectorND::is_equal_exact(vertices[5], VectorN{ 0.5, -1, 1.5 }));
 }
 
 TEST_CASE("[OrthoplexWireMeshND] Edges and Vertices") {
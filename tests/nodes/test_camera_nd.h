@@ -0,0 +1,87 @@
+#pragma once
+
+#include "../../nodes/camera_nd.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCameraND {
+TEST_CASE("[CameraND] View volume culling of local rects") {
+	CameraND *camera = memnew(CameraND);
+	camera->set_clip_near(0.1);
+	camera->set_clip_far(100.0);
+	camera->set_focal_length(1.0);
+	camera->set_perp_fade_mode(CameraND::PERP_FADE_TRANSPARENCY);
+	camera->set_perp_fade_distance(5.0);
+	camera->set_perp_fade_slope(0.0);
+	const Vector2 half_extents = camera->get_view_half_extents(Vector2(200, 100));
+	CHECK_MESSAGE(half_extents.is_equal_approx(Vector2(2, 1)), "CameraND view half extents should follow the aspect ratio with keep height.");
+
+	const Ref<RectND> in_front = RectND::from_position_size(VectorN{ -1, -1, -11, 0 }, VectorN{ 2, 2, 2, 1 });
+	CHECK_MESSAGE(!camera->is_local_rect_outside_view(in_front, half_extents), "CameraND should not cull a rect in front of it.");
+	const Ref<RectND> behind = RectND::from_position_size(VectorN{ -1, -1, 1, 0 }, VectorN{ 2, 2, 2, 0 });
+	CHECK_MESSAGE(camera->is_local_rect_outside_view(behind, half_extents), "CameraND should cull a rect behind the near plane.");
+	const Ref<RectND> beyond_far = RectND::from_position_size(VectorN{ -1, -1, -200, 0 }, VectorN{ 2, 2, 2, 0 });
+	CHECK_MESSAGE(camera->is_local_rect_outside_view(beyond_far, half_extents), "CameraND should cull a rect beyond the far plane.");
+	const Ref<RectND> straddling_near = RectND::from_position_size(VectorN{ -1, -1, -1, 0 }, VectorN{ 2, 2, 2, 0 });
+	CHECK_MESSAGE(!camera->is_local_rect_outside_view(straddling_near, half_extents), "CameraND should not cull a rect crossing the near plane.");
+
+	// At a depth of 10 with a focal length of 1, X is visible up to 20 and Y up to 10.
+	const Ref<RectND> right_side = RectND::from_position_size(VectorN{ 21, 0, -10, 0 }, VectorN{ 1, 1, 0, 0 });
+	CHECK_MESSAGE(camera->is_local_rect_outside_view(right_side, half_extents), "CameraND should cull a rect outside the right side hyperplane.");
+	const Ref<RectND> inside_right = RectND::from_position_size(VectorN{ 19, 0, -10, 0 }, VectorN{ 1, 1, 0, 0 });
+	CHECK_MESSAGE(!camera->is_local_rect_outside_view(inside_right, half_extents), "CameraND should not cull a rect inside the right side hyperplane.");
+	const Ref<RectND> below = RectND::from_position_size(VectorN{ 0, -12, -10, 0 }, VectorN{ 1, 1, 0, 0 });
+	CHECK_MESSAGE(camera->is_local_rect_outside_view(below, half_extents), "CameraND should cull a rect outside the bottom side hyperplane.");
+
+	// Rects fully faded by perpendicular distance are culled, but only with transparency fading.
+	const Ref<RectND> far_in_w = RectND::from_position_size(VectorN{ -1, -1, -11, 6 }, VectorN{ 2, 2, 2, 1 });
+	CHECK_MESSAGE(camera->is_local_rect_outside_view(far_in_w, half_extents), "CameraND should cull a rect fully faded by perpendicular distance.");
+	camera->set_perp_fade_mode(CameraND::PERP_FADE_HUE_SHIFT);
+	CHECK_MESSAGE(!camera->is_local_rect_outside_view(far_in_w, half_extents), "CameraND should not cull by perpendicular distance without transparency fading.");
+
+	// Relative positions below 3D are projected directly, so they are never culled.
+	const Ref<RectND> rect_2d = RectND::from_position_size(VectorN{ 1000, 1000 }, VectorN{ 1, 1 });
+	CHECK_MESSAGE(!camera->is_local_rect_outside_view(rect_2d, half_extents), "CameraND should not cull rects below 3D.");
+	memdelete(camera);
+}
+
+TEST_CASE("[CameraND] Batched projection matches single projection") {
+	CameraND *camera = memnew(CameraND);
+	camera->set_focal_length(1.5);
+	camera->set_orthographic_size(2.0);
+	const PackedFloat64Array vertices_flat = { 1, 2, -3, 4, -5, 0.5, -10, 0, 0, 0, -1, 2 };
+	for (int projection = 0; projection < 2; projection++) {
+		camera->set_projection_type(projection == 0 ? CameraND::PROJECTION_PERSPECTIVE : CameraND::PROJECTION_ORTHOGRAPHIC);
+		const PackedVector2Array projected = camera->project_many(vertices_flat, 4);
+		REQUIRE(projected.size() == 3);
+		for (int i = 0; i < 3; i++) {
+			const VectorN vertex = { vertices_flat[i * 4], vertices_flat[i * 4 + 1], vertices_flat[i * 4 + 2], vertices_flat[i * 4 + 3] };
+			CHECK_MESSAGE(projected[i].is_equal_approx(camera->world_to_viewport_local_normal(vertex)), "CameraND project_many should match world_to_viewport_local_normal.");
+		}
+	}
+	// Scale, offset, distances, and perpendicular components.
+	Vector2 projected[3];
+	double distances[3];
+	double perp_components[3];
+	camera->project_many_ptr(vertices_flat.ptr(), 3, 4, false, Vector2(10, 10), Vector2(5, 5), projected, distances, perp_components);
+	const VectorN first = { 1, 2, -3, 4 };
+	CHECK_MESSAGE(projected[0].is_equal_approx(camera->world_to_viewport_local_normal(first) * 10 + Vector2(5, 5)), "CameraND project_many_ptr should apply the scale and offset.");
+	CHECK_MESSAGE(distances[0] == doctest::Approx(Math::sqrt(30.0)), "CameraND project_many_ptr should output the distance of each vertex.");
+	CHECK_MESSAGE(perp_components[2] == doctest::Approx(2.0), "CameraND project_many_ptr should output the components beyond XYZ.");
+	// The bound variant returns the same outputs.
+	const Dictionary projected_dict = camera->project_many_dict(vertices_flat, 4);
+	const PackedVector2Array bound_projected = projected_dict["projected"];
+	const PackedFloat64Array bound_distances = projected_dict["distances"];
+	const PackedFloat64Array bound_perp_components = projected_dict["perpendicular_components"];
+	REQUIRE(bound_projected.size() == 3);
+	REQUIRE(bound_distances.size() == 3);
+	REQUIRE(bound_perp_components.size() == 3);
+	CHECK_MESSAGE(bound_projected[0].is_equal_approx(camera->world_to_viewport_local_normal(first)), "CameraND project_many_dict should match project_many.");
+	CHECK_MESSAGE(bound_distances[0] == doctest::Approx(Math::sqrt(30.0)), "CameraND project_many_dict should output the distance of each vertex.");
+	CHECK_MESSAGE(bound_perp_components[2] == doctest::Approx(2.0), "CameraND project_many_dict should output the components beyond XYZ.");
+	const Dictionary without_perp = camera->project_many_dict(PackedFloat64Array{ 1, 2, -3 }, 3);
+	const PackedFloat64Array no_perp_components = without_perp["perpendicular_components"];
+	CHECK_MESSAGE(no_perp_components.is_empty(), "CameraND project_many_dict should not output components beyond XYZ for 3D vertices.");
+	memdelete(camera);
+}
+} // namespace TestCameraND
@@ -8,4 +8,73 @@ namespace TestNodeND {
 TEST_CASE("[NodeND]") {
 	NodeND test = NodeND();
 }
+
+TEST_CASE("[NodeND] Global transform cache follows changes") {
+	NodeND *parent = memnew(NodeND);
+	NodeND *child = memnew(NodeND);
+	parent->add_child(child);
+	parent->set_position(VectorN{ 1, 2, 3 });
+	child->set_position(VectorN{ 0, 0, 1 });
+	CHECK_MESSAGE(VectorND::is_equal_approx(child->get_global_position(), VectorN{ 1, 2, 4 }), "NodeND global position should include the parent position.");
+
+	// Changing the parent must invalidate the cached global transform of the child.
+	parent->set_transform(TransformND::from_scale(VectorN{ 2, 2, 2 }));
+	CHECK_MESSAGE(VectorND::is_equal_approx(child->get_global_position(), VectorN{ 0, 0, 2 }), "NodeND global position should update when the parent transform is replaced.");
+	// The transform reference can also be modified in place.
+	parent->get_transform()->set_origin(VectorN{ 5, 0, 0 });
+	CHECK_MESSAGE(VectorND::is_equal_approx(child->get_global_position(), VectorN{ 5, 0, 2 }), "NodeND global position should update when the parent transform is modified in place.");
+	CHECK_MESSAGE(child->get_global_basis()->is_equal_approx(BasisND::from_scale(VectorN{ 2, 2, 2 })), "NodeND global basis should include the parent basis.");
+
+	// Modifying the returned global transform must not corrupt the cache.
+	child->get_global_transform()->set_origin(VectorN{ 100, 100, 100 });
+	CHECK_MESSAGE(VectorND::is_equal_approx(child->get_global_position(), VectorN{ 5, 0, 2 }), "NodeND get_global_transform should return a copy.");
+
+	// A null transform is rejected, keeping the current one.
+	ERR_PRINT_OFF;
+	parent->set_transform(Ref<TransformND>());
+	ERR_PRINT_ON;
+	REQUIRE(parent->get_transform().is_valid());
+	CHECK(VectorND::is_equal_approx(child->get_global_position(), VectorN{ 5, 0, 2 }));
+
+	// Reparenting must invalidate the cache as well.
+	parent->remove_child(child);
+	CHECK_MESSAGE(VectorND::is_equal_approx(child->get_global_position(), VectorN{ 0, 0, 1 }), "NodeND global position should update when removed from the parent.");
+	memdelete(child);
+	memdelete(parent);
+}
+
+TEST_CASE("[NodeND] Global transform cache invalidation reaches all descendants") {
+	NodeND *root = memnew(NodeND);
+	NodeND *middle = memnew(NodeND);
+	NodeND *leaf = memnew(NodeND);
+	root->add_child(middle);
+	middle->add_child(leaf);
+	leaf->set_position(VectorN{ 0, 0, 1 });
+	CHECK(VectorND::is_equal_approx(leaf->get_global_position(), VectorN{ 0, 0, 1 }));
+
+	// Setters push the change down past the middle node, which is not queried.
+	root->set_position(VectorN{ 1, 0, 0 });
+	CHECK_MESSAGE(VectorND::is_equal_approx(leaf->get_global_position(), VectorN{ 1, 0, 1 }), "NodeND setters should invalidate the caches of all descendants.");
+	// A second change before any query stops at the already dirty subtree.
+	root->set_position(VectorN{ 2, 0, 0 });
+	middle->set_position(VectorN{ 0, 3, 0 });
+	CHECK_MESSAGE(VectorND::is_equal_approx(leaf->get_global_position(), VectorN{ 2, 3, 1 }), "NodeND should see changes made while the caches were already dirty.");
+
+	// In-place edits of a kept reference to the root's transform reach the leaf as well.
+	const Ref<TransformND> root_transform = root->get_transform();
+	root_transform->set_origin(VectorN{ 4, 0, 0 });
+	CHECK_MESSAGE(VectorND::is_equal_approx(leaf->get_global_position(), VectorN{ 4, 3, 1 }), "NodeND should detect in-place edits of an ancestor's transform.");
+	// Querying the middle node first must not hide the change from the leaf.
+	root_transform->set_origin(VectorN{ 5, 0, 0 });
+	CHECK(VectorND::is_equal_approx(middle->get_global_position(), VectorN{ 5, 3, 0 }));
+	CHECK_MESSAGE(VectorND::is_equal_approx(leaf->get_global_position(), VectorN{ 5, 3, 1 }), "NodeND should detect in-place edits of an ancestor's transform after the parent was updated.");
+
+	// A transform passed to set_transform is still referenced by the caller, who may modify it later.
+	const Ref<TransformND> middle_transform = TransformND::from_position(VectorN{ 0, 6, 0 });
+	middle->set_transform(middle_transform);
+	CHECK(VectorND::is_equal_approx(leaf->get_global_position(), VectorN{ 5, 6, 1 }));
+	middle_transform->set_origin(VectorN{ 0, 7, 0 });
+	CHECK_MESSAGE(VectorND::is_equal_approx(leaf->get_global_position(), VectorN{ 5, 7, 1 }), "NodeND should detect in-place edits of a transform passed to set_transform.");
+	memdelete(root);
+}
 } // namespace TestNodeND
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../../model/mesh/mesh_instance_nd.h"
+#include "../../model/mesh/wire/wire_mesh_nd.h"
+#include "../../nodes/camera_nd.h"
+#include "../../render/rendering_engine_nd.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRenderingEngineND {
+// Exposes the edge color cache, which is otherwise only used by rendering engines.
+class EdgeColorTestRenderingEngineND : public RenderingEngineND {
+public:
+	using RenderingEngineND::_get_edge_colors;
+};
+
+// Edges can be changed without bumping the mesh version, like a mesh overriding _get_edge_indices from a script.
+class EdgeColorTestMeshND : public WireMeshND {
+public:
+	PackedInt32Array edge_indices;
+	virtual PackedInt32Array get_edge_indices() override { return edge_indices; }
+};
+
+// Counts how many times the cache asks the material for the edge colors.
+class EdgeColorTestMaterialND : public MaterialND {
+public:
+	mutable int calculate_count = 0;
+	virtual void get_albedo_colors_of_edges(const Ref<MeshND> &p_for_mesh, PackedColorArray &r_edge_colors) const override {
+		calculate_count++;
+		MaterialND::get_albedo_colors_of_edges(p_for_mesh, r_edge_colors);
+	}
+};
+
+TEST_CASE("[RenderingEngineND] Edge color cache") {
+	Ref<EdgeColorTestRenderingEngineND> engine = memnew(EdgeColorTestRenderingEngineND);
+	Ref<EdgeColorTestMeshND> mesh = memnew(EdgeColorTestMeshND);
+	mesh->edge_indices = PackedInt32Array{ 0, 1, 1, 2 };
+	Ref<EdgeColorTestMaterialND> material = memnew(EdgeColorTestMaterialND);
+	material->set_albedo_color(Color(1, 0, 0));
+	PackedColorArray edge_colors = engine->_get_edge_colors(mesh, material);
+	CHECK(material->calculate_count == 1);
+	CHECK(edge_colors == PackedColorArray{ Color(1, 0, 0), Color(1, 0, 0) });
+	// Nothing changed, so the cached colors are used.
+	edge_colors = engine->_get_edge_colors(mesh, material);
+	CHECK_MESSAGE(material->calculate_count == 1, "RenderingEngineND edge colors should be cached while the mesh and material versions are the same.");
+	// Changing the material bumps its version.
+	material->set_albedo_color(Color(0, 0, 1));
+	edge_colors = engine->_get_edge_colors(mesh, material);
+	CHECK_MESSAGE(material->calculate_count == 2, "RenderingEngineND edge colors should be recalculated when the material version changes.");
+	CHECK(edge_colors == PackedColorArray{ Color(0, 0, 1), Color(0, 0, 1) });
+	// Adding an edge without bumping the mesh version must still resize the colors.
+	mesh->edge_indices.append(2);
+	mesh->edge_indices.append(0);
+	edge_colors = engine->_get_edge_colors(mesh, material);
+	CHECK_MESSAGE(material->calculate_count == 3, "RenderingEngineND edge colors should be recalculated when the edge count changes.");
+	CHECK(edge_colors.size() == 3);
+	// If the material can't color every edge, the missing edges use its single color.
+	material->set_albedo_source_flags(MaterialND::COLOR_SOURCE_FLAG_PER_EDGE);
+	material->set_albedo_color_array(PackedColorArray{ Color(0, 1, 0) });
+	ERR_PRINT_OFF;
+	edge_colors = engine->_get_edge_colors(mesh, material);
+	ERR_PRINT_ON;
+	CHECK(edge_colors == PackedColorArray{ Color(0, 0, 1), Color(0, 0, 1), Color(0, 0, 1) });
+	// Without a material, edges are white.
+	edge_colors = engine->_get_edge_colors(mesh, Ref<MaterialND>());
+	CHECK(edge_colors == PackedColorArray{ Color(1, 1, 1), Color(1, 1, 1), Color(1, 1, 1) });
+}
+
+TEST_CASE("[RenderingEngineND] Relative transforms are not changed by later frames") {
+	CameraND *camera = memnew(CameraND);
+	MeshInstanceND *mesh_instance = memnew(MeshInstanceND);
+	mesh_instance->set_position(VectorN{ 1, 0, 0 });
+	Ref<RenderingEngineND> engine = memnew(RenderingEngineND);
+	engine->set_camera(camera);
+	engine->set_mesh_instance_object_ids(PackedInt64Array{ (int64_t)mesh_instance->get_instance_id() });
+	engine->calculate_relative_transforms();
+	const TypedArray<TransformND> first_transforms = engine->get_mesh_relative_transforms();
+	REQUIRE(first_transforms.size() == 1);
+	// The next frame reuses the transforms of the render list, which must not show up in the first array.
+	mesh_instance->set_position(VectorN{ 2, 0, 0 });
+	engine->calculate_relative_transforms();
+	const TypedArray<TransformND> second_transforms = engine->get_mesh_relative_transforms();
+	REQUIRE(second_transforms.size() == 1);
+	const Ref<TransformND> first_transform = first_transforms[0];
+	const Ref<TransformND> second_transform = second_transforms[0];
+	CHECK_MESSAGE(first_transform->get_origin_element(0) == doctest::Approx(1.0), "A relative transform returned in an earlier frame should keep its value.");
+	CHECK(second_transform->get_origin_element(0) == doctest::Approx(2.0));
+	memdelete(mesh_instance);
+	memdelete(camera);
+}
+} // namespace TestRenderingEngineND
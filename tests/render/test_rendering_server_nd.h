@@ -0,0 +1,116 @@
+#pragma once
+
+#include "../../model/mesh/mesh_instance_nd.h"
+#include "../../model/mesh/wire/array_wire_mesh_nd.h"
+#include "../../nodes/camera_nd.h"
+#include "../../render/rendering_server_nd.h"
+
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#if GODOT_VERSION_MAJOR == 4 && GODOT_VERSION_MINOR < 6
+#include "servers/rendering_server.h"
+#else
+#include "servers/rendering/rendering_server.h"
+#endif
+#include "tests/test_macros.h"
+
+namespace TestRenderingServerND {
+// Counts the frames that RenderingServerND asks it to render.
+class RedrawTestRenderingEngineND : public RenderingEngineND {
+public:
+	int render_count = 0;
+	virtual String get_friendly_name() const override { return "Redraw Test"; }
+	virtual void render_frame() override { render_count++; }
+};
+
+// RenderingServerND renders ND frames when Godot is about to draw a frame.
+inline void draw_frame() {
+	RenderingServer::get_singleton()->emit_signal(StringName("frame_pre_draw"));
+}
+
+TEST_CASE("[SceneTree][RenderingServerND] Redraw on change renders changes and skips idle frames") {
+	RenderingServerND *server = RenderingServerND::get_singleton();
+	REQUIRE(server != nullptr);
+	Ref<RedrawTestRenderingEngineND> engine;
+	engine.instantiate();
+	server->register_rendering_engine(engine);
+	Window *root = SceneTree::get_singleton()->get_root();
+	CameraND *camera = memnew(CameraND);
+	camera->set_rendering_engine_name("Redraw Test");
+	root->add_child(camera);
+	MeshInstanceND *mesh_instance = memnew(MeshInstanceND);
+	Ref<ArrayWireMeshND> mesh;
+	mesh.instantiate();
+	mesh_instance->set_mesh(mesh);
+	Ref<MaterialND> material;
+	material.instantiate();
+	mesh_instance->set_material_override(material);
+	root->add_child(mesh_instance);
+	server->set_redraw_on_change_enabled(true);
+	draw_frame();
+	CHECK_MESSAGE(engine->render_count == 1, "RenderingServerND should render the first frame.");
+	// An idle frame does not need another redraw.
+	draw_frame();
+	CHECK_MESSAGE(engine->render_count == 1, "RenderingServerND should not render a frame when nothing changed.");
+	// Moving a node needs a redraw.
+	mesh_instance->set_position(VectorN{ 1, 2, 3 });
+	draw_frame();
+	CHECK_MESSAGE(engine->render_count == 2, "RenderingServerND should render a frame after a node moves.");
+	// Changing the camera needs a redraw.
+	camera->set_clip_far(123.0);
+	draw_frame();
+	CHECK_MESSAGE(engine->render_count == 3, "RenderingServerND should render a frame after a camera property changes.");
+	// Changing the material needs a redraw, including appending colors.
+	material->append_albedo_color(Color(1, 0, 0));
+	draw_frame();
+	CHECK_MESSAGE(engine->render_count == 4, "RenderingServerND should render a frame after a color is appended to a material.");
+	material->set_albedo_color(Color(0, 1, 0));
+	draw_frame();
+	CHECK_MESSAGE(engine->render_count == 5, "RenderingServerND should render a frame after a material property changes.");
+	draw_frame();
+	CHECK(engine->render_count == 5);
+	server->set_redraw_on_change_enabled(false);
+	memdelete(mesh_instance);
+	memdelete(camera);
+	server->unregister_rendering_engine("Redraw Test");
+	root->remove_meta("last_rendering_engine_name_nd");
+}
+
+TEST_CASE("[SceneTree][RenderingServerND] Mesh with invalid data is checked again when it changes") {
+	RenderingServerND *server = RenderingServerND::get_singleton();
+	REQUIRE(server != nullptr);
+	Ref<RedrawTestRenderingEngineND> engine;
+	engine.instantiate();
+	server->register_rendering_engine(engine);
+	Window *root = SceneTree::get_singleton()->get_root();
+	CameraND *camera = memnew(CameraND);
+	camera->set_rendering_engine_name("Redraw Test");
+	root->add_child(camera);
+	// The edge references vertices that do not exist yet.
+	Ref<ArrayWireMeshND> mesh;
+	mesh.instantiate();
+	mesh->append_edge_indices(0, 1);
+	MeshInstanceND *mesh_instance = memnew(MeshInstanceND);
+	mesh_instance->set_mesh(mesh);
+	root->add_child(mesh_instance);
+	server->set_redraw_on_change_enabled(true);
+	ERR_PRINT_OFF;
+	draw_frame();
+	ERR_PRINT_ON;
+	CHECK(engine->render_count == 1);
+	// Invalid mesh data alone does not keep requesting frames.
+	draw_frame();
+	draw_frame();
+	CHECK_MESSAGE(engine->render_count == 1, "RenderingServerND should not render frames while an invalid mesh is unchanged.");
+	// Fixing the mesh data checks the mesh again on the next frame.
+	mesh->append_vertex(VectorN{ 0, 0, 0 });
+	mesh->append_vertex(VectorN{ 1, 0, 0 });
+	draw_frame();
+	CHECK_MESSAGE(engine->render_count == 2, "RenderingServerND should render a frame after the mesh data changes.");
+	server->set_redraw_on_change_enabled(false);
+	memdelete(mesh_instance);
+	memdelete(camera);
+	server->unregister_rendering_engine("Redraw Test");
+	root->remove_meta("last_rendering_engine_name_nd");
+}
+} // namespace TestRenderingServerND
@@ -4,12 +4,18 @@
 
 #include "math/test_basis_nd.h"
 #include "math/test_geometry_nd.h"
+#include "math/test_math_nd.h"
 #include "math/test_plane_nd.h"
 #include "math/test_rect_nd.h"
 #include "math/test_transform_nd.h"
 #include "math/test_vector_nd.h"
+#include "model/test_binary_mesh_nd.h"
 #include "model/test_cell_mesh_nd.h"
 #include "model/test_mesh_instance_nd.h"
 #include "model/test_mesh_nd.h"
+#include "model/test_off_document_nd.h"
 #include "model/test_wire_mesh_nd.h"
+#include "nodes/test_camera_nd.h"
 #include "nodes/test_node_nd.h"
+#include "render/test_rendering_engine_nd.h"
+#include "render/test_rendering_server_nd.h"